@@ -0,0 +1,85 @@
+/// @file Vector-map-test.cxx
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file contains Catch2 unit tests for the mapped storage of the
+/// Vector class: a Vector over a mapped file, and over an anonymous mapping,
+/// must both keep their elements when they grow.
+
+#include <cstdio>   // provides std::remove
+#include <cstdlib>  // provides mkstemp
+#include <fstream>
+#include <string>
+
+#include <unistd.h>  // provides close
+
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+
+#include "Vector.h"
+
+/// Writes text to a temporary file and returns its path.
+/// @param text The contents of the file.
+/// @return     The path of the file.
+static std::string writeTemporary(const std::string& text) {
+    char path[] = "/tmp/vector-map-testXXXXXX";
+    const int fd = ::mkstemp(path);
+    REQUIRE(fd >= 0);
+    ::close(fd);
+
+    std::ofstream file(path, std::ios::binary);
+    file << text;
+    return path;
+}
+
+TEST_CASE("Vector over a mapped file", "[Vector]") {
+    std::string sequence;
+    for (int i = 0; i < 4000; ++i) {
+        sequence += "ACGT";
+    }
+
+    SECTION("growing a file mapping without leading whitespace copies it") {
+        const std::string path = writeTemporary(sequence + "\n");
+        Vector vector = Vector::map_file(path);
+        CHECK(vector.mapped());
+        CHECK(vector.size() == sequence.size());
+
+        for (int i = 0; i < 20000; ++i) {
+            vector.push_back('A');
+        }
+        CHECK(vector.size() == sequence.size() + 20000);
+        CHECK(vector.at(0) == 'A');
+        CHECK(vector.at(sequence.size() - 1) == 'T');
+        CHECK(vector.at(vector.size() - 1) == 'A');
+        std::remove(path.c_str());
+    }
+
+    SECTION("growing a file mapping with leading whitespace copies it") {
+        const std::string path = writeTemporary(" " + sequence + "\n");
+        Vector vector = Vector::map_file(path);
+        CHECK(vector.size() == sequence.size());
+
+        for (int i = 0; i < 20000; ++i) {
+            vector.push_back('C');
+        }
+        CHECK(vector.at(1) == 'C');
+        CHECK(vector.at(sequence.size()) == 'C');
+        std::remove(path.c_str());
+    }
+}
+
+TEST_CASE("Vector over an anonymous mapping", "[Vector]") {
+    SECTION("growing past a huge page keeps the elements") {
+        Vector vector(Vector::HUGE_PAGE, 'G');
+        CHECK(vector.mapped());
+
+        for (Vector::size_type i = 0; i < Vector::HUGE_PAGE; ++i) {
+            vector.push_back('T');
+        }
+        CHECK(vector.size() == 2 * Vector::HUGE_PAGE);
+        CHECK(vector.at(Vector::HUGE_PAGE - 1) == 'G');
+        CHECK(vector.at(Vector::HUGE_PAGE) == 'T');
+    }
+}
+
+/* EOF */
@@ -19,7 +19,97 @@
 // header files
 #include "Vector.h"
 #include <cassert>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
 #include <iostream>
+#include <system_error>
+
+// POSIX memory mapping
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* Storage */
+
+/// Allocates storage for capacity characters. Small buffers come from the
+/// heap; buffers of at least HUGE_PAGE characters are anonymous mappings,
+/// rounded up to whole huge pages, that the kernel is asked to back with
+/// transparent huge pages. A failed mapping falls back to the heap.
+///
+/// @param capacity The number of characters to allocate.
+/// @param map      Set to the start of the mapping, or nullptr for the heap.
+/// @param mapSize  Set to the length of the mapping in bytes.
+/// @return         A pointer to the storage.
+static Vector::pointer allocate(Vector::size_type capacity,
+                                Vector::pointer& map,
+                                Vector::size_type& mapSize) {
+    map = nullptr;
+    mapSize = 0;
+
+    if (capacity >= Vector::HUGE_PAGE) {
+        const Vector::size_type length =
+            (capacity + Vector::HUGE_PAGE - 1) / Vector::HUGE_PAGE *
+            Vector::HUGE_PAGE;
+        void* storage = ::mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (storage != MAP_FAILED) {
+#ifdef MADV_HUGEPAGE
+            ::madvise(storage, length, MADV_HUGEPAGE);
+#endif
+            map = static_cast<Vector::pointer>(storage);
+            mapSize = length;
+            return map;
+        }
+    }
+
+    return new Vector::value_type[capacity];
+}
+
+/// Releases storage obtained from allocate or map_file.
+///
+/// @param data    A pointer to the first element of the storage.
+/// @param map     The start of the mapping, or nullptr for the heap.
+/// @param mapSize The length of the mapping in bytes.
+static void deallocate(Vector::pointer data, Vector::pointer map,
+                       Vector::size_type mapSize) {
+    if (map != nullptr) {
+        ::munmap(map, mapSize);
+    } else {
+        delete[] data;
+    }
+}
+
+/// Grows an anonymous mapping to hold at least capacity characters without
+/// copying them: the kernel moves the pages to a larger range if needed.
+///
+/// @param map      The start of the mapping, updated if it moves.
+/// @param mapSize  The length of the mapping in bytes, updated on success.
+/// @param capacity The number of characters the mapping must hold.
+/// @return         True on success, false if the mapping was left unchanged.
+static bool remap(Vector::pointer& map, Vector::size_type& mapSize,
+                  Vector::size_type capacity) {
+#ifdef MREMAP_MAYMOVE
+    const Vector::size_type length =
+        (capacity + Vector::HUGE_PAGE - 1) / Vector::HUGE_PAGE *
+        Vector::HUGE_PAGE;
+    void* storage = ::mremap(map, mapSize, length, MREMAP_MAYMOVE);
+
+    if (storage != MAP_FAILED) {
+        map = static_cast<Vector::pointer>(storage);
+        mapSize = length;
+        return true;
+    }
+#else
+    static_cast<void>(map);
+    static_cast<void>(mapSize);
+    static_cast<void>(capacity);
+#endif
+
+    return false;
+}
 
 /* Constructors and Destructor */
 
@@ -41,12 +131,11 @@ Vector::Vector(size_type count, const value_type& value) {
     m_capacity = (count);
 
     // memory allocate
-    m_data = new value_type[m_capacity];
+    m_data = ::allocate(m_capacity, m_map, m_map_size);
+    m_map_file = false;
 
     //// initialize elements with value
-    for (size_type i = 0; i < m_count; ++i) {
-        *(m_data + i) = value;
-    }
+    std::memset(m_data, value, m_count);
 }
 
 /// Copy constructor. Constructs the container with the copy of the contents
@@ -61,15 +150,16 @@ Vector::Vector(const Vector& other) {
     m_count = 0;
 
     // assign memory for the pointer
-    m_data = new value_type[other.m_capacity];
+    m_data = ::allocate(other.m_capacity, m_map, m_map_size);
+    m_map_file = false;
 
     // assign values from previous array
     m_count = other.m_count;
     m_capacity = other.m_capacity;
 
     // copy data
-    for (size_type i = 0; i < other.m_count; ++i) {
-        *(m_data + i) = *(other.m_data + i);
+    if (m_count > 0) {
+        std::memcpy(m_data, other.m_data, m_count);
     }
 
 }
@@ -79,30 +169,21 @@ Vector::Vector(const Vector& other) {
 ///
 /// @param other The Vector to be moved.
 Vector::Vector(Vector&& other) {
-    // TODO(David Tom): move vector from other
-
-    // clean slate
-    m_data = nullptr;
-    m_capacity = 0;
-    m_count = 0;
-
-    // assign memory for the temporary pointer
-    m_data = new value_type[other.m_capacity];
-
-    // assign values from previous array
+    // take over other's storage, a mapping is never copied
+    m_data = other.m_data;
     m_count = other.m_count;
     m_capacity = other.m_capacity;
+    m_map = other.m_map;
+    m_map_size = other.m_map_size;
+    m_map_file = other.m_map_file;
 
-    // copy data
-    for (size_type i = 0; i < other.m_count; ++i) {
-        *(m_data + i) = *(other.m_data + i);
-    }
-
-    // delete other's data
-    other.clear();
+    // leave other empty
     other.m_data = nullptr;
     other.m_count = 0;
     other.m_capacity = 0;
+    other.m_map = nullptr;
+    other.m_map_size = 0;
+    other.m_map_file = false;
 
 }
 
@@ -110,12 +191,80 @@ Vector::Vector(Vector&& other) {
 Vector::~Vector() {
     // TODO(David Tom): deletes vector
     // delete data
-    delete[] m_data;
+    ::deallocate(m_data, m_map, m_map_size);
 
     // assign values to 0
     m_data = nullptr;
     m_capacity = 0;
     m_count = 0;
+    m_map = nullptr;
+    m_map_size = 0;
+    m_map_file = false;
+}
+
+/// Maps the file at path into memory and returns a Vector of its
+/// characters, without the whitespace surrounding them (e.g., the final
+/// newline). No character is copied: pages are read on first access and
+/// a page is only duplicated when it is written to, so the file itself is
+/// never modified. The mapping is replaced by regular storage the first
+/// time the Vector grows.
+/// @note The file must not be truncated while it is mapped.
+/// @param path The path of the file to map.
+/// @return     A Vector viewing the contents of the file.
+/// @throws std::system_error if the file cannot be opened or mapped.
+Vector Vector::map_file(const std::string& path) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::system_error(errno, std::generic_category(), path);
+    }
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        const int error = errno;
+        ::close(fd);
+        throw std::system_error(error, std::generic_category(), path);
+    }
+
+    Vector vector;
+    const size_type length = static_cast<size_type>(info.st_size);
+
+    if (length > 0) {
+        // private and writable: writes go to copies of the pages only
+        void* storage = ::mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE, fd, 0);
+        if (storage == MAP_FAILED) {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), path);
+        }
+        ::madvise(storage, length, MADV_SEQUENTIAL);
+
+        // skip the whitespace surrounding the sequence
+        pointer first = static_cast<pointer>(storage);
+        pointer last  = first + length;
+        while (first != last &&
+               std::isspace(static_cast<unsigned char>(*first))) {
+            ++first;
+        }
+        while (last != first &&
+               std::isspace(static_cast<unsigned char>(*(last - 1)))) {
+            --last;
+        }
+
+        // replace the empty heap array by the mapping
+        ::deallocate(vector.m_data, vector.m_map, vector.m_map_size);
+        vector.m_map = static_cast<pointer>(storage);
+        vector.m_map_size = length;
+        vector.m_map_file = true;
+        vector.m_data = first;
+        vector.m_count = static_cast<size_type>(last - first);
+        vector.m_capacity = vector.m_count;
+    }
+
+    // the mapping stays valid after the descriptor is closed
+    ::close(fd);
+
+    return vector;
 }
 
 /* Element Access */
@@ -293,58 +442,87 @@ Vector::const_pointer Vector::end() const {
 /// @return      A pointer to the inserted elements.
 Vector::pointer Vector::insert(Vector::const_pointer pos,
                         const Vector::value_type& value) {
-    // TODO(David Tom): insert elements into new array, cleanup as needed
-    // copy array to new array, append to given location, add value if i = pos,
-    // add old array values to new array, copy new array to old array, cleanup
+    // copy the value first, it may refer to an element being shifted
+    const value_type copy = value;
+
+    // insert a range of one element
+    return insert(pos, &copy, &copy + 1);
+}
 
+/// Inserts the elements in the range (first, last) before pos. The array is
+/// reallocated at most once for the whole range, and only if the range does
+/// not fit into the spare capacity; otherwise the tail is shifted in place.
+///
+/// @param pos   The position where the elements should be inserted.
+/// @param first A pointer to the first element to insert.
+/// @param last  A pointer to one past the last element to insert. The range
+///              may only refer to this Vector when pos is end().
+/// @return      A pointer to the first inserted element.
+Vector::pointer Vector::insert(Vector::const_pointer pos,
+                        Vector::const_pointer first,
+                        Vector::const_pointer last) {
     pointer new_data;            // set a pointer to a new array
     size_type posIndex;          // tracks the position of the index
     posIndex = static_cast<size_type>(pos - m_data);   // index position
+    size_type count;             // number of elements inserted
+    count = static_cast<size_type>(last - first);
 
-    // clean slate
-    new_data = nullptr;
-
-    // check if capacity is 0 and add 1
-    if (m_capacity == 0) {
-        m_capacity += 1;
-    }
-
-    // check if size is equal to or near capacity
-    if ((m_count) >= (m_capacity)) {
-        // double size of capacity
+    // check if the range does not fit into the spare capacity
+    if ((m_count + count) > (m_capacity)) {
+        // double size of capacity, or more for a large range
         m_capacity *= 2;
-    }
-
-    // assign memory for the temporary pointer
-    new_data = new value_type[m_capacity];
-
-    if (!empty()) {
-        // copy initial data
-        for (size_type i = 0; i < (posIndex); ++i) {
-            // copy data
-            *(new_data + i) = *(m_data + i);
+        if (m_capacity < m_count + count) {
+            m_capacity = m_count + count;
         }
 
-        // if at position append value
-        *(new_data + posIndex) = value;
-
-        // finish copying data at pos + 1
-        for (size_type i = ((posIndex)); i < (m_count); ++i) {
-            *(new_data + (i + 1)) = *(m_data + (i));
+        // a range appended to an anonymous mapping that does not refer to
+        // it: let the kernel grow the mapping instead of copying it. A file
+        // mapping is never grown, its pages past the end of the file would
+        // fault
+        const bool anonymous = m_map != nullptr && !m_map_file;
+        const bool aliased   = first >= m_data && first < m_data + m_count;
+
+        if (anonymous && !aliased && posIndex == m_count &&
+            ::remap(m_map, m_map_size, m_capacity)) {
+            m_data = m_map;
+            std::memcpy(m_data + posIndex, first, count);
+        } else {
+            pointer   new_map;       // start of the new mapping, if any
+            size_type new_map_size;  // length of the new mapping
+
+            // assign memory for the temporary pointer
+            new_data = ::allocate(m_capacity, new_map, new_map_size);
+
+            // copy data before and after the position, leaving a gap of
+            // count
+            std::memcpy(new_data, m_data, posIndex);
+            std::memcpy(new_data + posIndex + count, m_data + posIndex,
+                        m_count - posIndex);
+
+            // copy the range into the gap before deleting, it may refer to
+            // the old data
+            std::memcpy(new_data + posIndex, first, count);
+
+            // delete old data
+            ::deallocate(m_data, m_map, m_map_size);
+
+            // update data pointer
+            m_data = new_data;
+            m_map = new_map;
+            m_map_size = new_map_size;
+            m_map_file = false;
         }
+    } else if (count > 0) {
+        // shift the data after the position up by count in place
+        std::memmove(m_data + posIndex + count, m_data + posIndex,
+                     m_count - posIndex);
 
-    } else {
-        *(new_data) = value;
+        // copy the range into the gap
+        std::memcpy(m_data + posIndex, first, count);
     }
 
-    // delete old data
-    delete[] m_data;
-
-    // update data pointer
-    m_data = new_data;
-
     // Increment
-    m_count += 1;
+    m_count += count;
 
     return (m_data + posIndex);
 }
@@ -354,46 +532,17 @@ Vector::pointer Vector::insert(Vector::const_pointer pos,
 /// @param pos The position of the element to be erased.
 /// @return    A pointer to the elements following the erased element.
 Vector::pointer Vector::erase(Vector::pointer pos) {
-    // TODO(David Tom): erase elements from old array, cleanup as needed
-    // copy array to new array, delete at given location, delete value i = pos,
-    // add old array values to new array, copy new array to old array, cleanup
-
-    pointer new_data;            // set a pointer to a new array
     size_type posIndex;          // tracks index for arrays
     posIndex = static_cast<size_type>(pos - m_data);   // index position
 
-    // check if array is empty
-    if (m_capacity != 0) {
-        // clean slate
-        new_data = nullptr;
-
-        // check if size is equal to or near capacity
-        if ((m_count + 1) >= (m_capacity)) {
-            // double size of capacity
-            m_capacity *= 2;
-        }
-
-        // assign memory for the temporary pointer
-        new_data = new value_type[m_capacity];
-
-        // copy data until position of desired value
-        for (size_type i = 0; i < posIndex; ++i) {
-            *(new_data + i) = *(m_data + (i));
-        }
-
-        // copy remaining data from (i + 1) to (i)
-        for (size_type i = (posIndex); i < ((m_count) - 1); ++i) {
-            *(new_data + i) = *(m_data + (i + 1));
-        }
-
-        // delete old data
-        delete[] m_data;
+    // check if array is empty and pos refers to an element
+    if (posIndex < m_count) {
+        // shift remaining data from (i + 1) to (i) in place
+        std::memmove(m_data + posIndex, m_data + posIndex + 1,
+                     m_count - posIndex - 1);
 
         // append count value
         m_count -= 1;
-
-        // update data pointer
-        m_data = new_data;
     }
 
     return (m_data + posIndex);
@@ -425,6 +574,14 @@ Vector::size_type Vector::capacity() const {
     return m_capacity;
 }
 
+/// Checks if the elements live in a memory mapping, i.e., a mapped file or
+/// a buffer of at least HUGE_PAGE characters.
+/// @return True if the storage is mapped, false if it is on the heap.
+bool Vector::mapped() const {
+
+    return m_map != nullptr;
+}
+
 
 /* Modifiers */
 
@@ -434,8 +591,10 @@ void Vector::clear() {
     // TODO(David Tom): create empty bag with all empty values.
     // loop through bag's capacity and assign empty values to all indexes
 
-    for (Vector::size_type i = 0; i < m_capacity; ++i) {
-        *(m_data + i) = 'A';
+    // mapped storage is left untouched, filling it would fault in (and for a
+    // file, copy) every page
+    if (m_map == nullptr && m_data != nullptr) {
+        std::memset(m_data, 'A', m_capacity);
     }
 
     m_count = 0;
@@ -455,48 +614,9 @@ void Vector::clear() {
 ///
 /// @param value The value to be appended to the end of the container.
 void Vector::push_back(const value_type& value) {
-    // TODO(David Tom): check and, if needed, double the capacity
-    // create copy array, add values to it, delete/rebuild old array,
-    // copy data to old array with new capacity, add new data starting at end
-
-    pointer new_data;           // set a pointer to a new array
-
-    // clean slate
-    // new_data = nullptr;
-
-    // check if capacity is 0
-    if (m_capacity == 0) {
-        m_capacity += 1;
-    }
-
-    // check if size is equal to or near capacity
-    if (m_count >= (m_capacity)) {
-        // double size of capacity
-        m_capacity *= 2;
-        }
-
-    // Create a new array with the updated capacity
-    new_data = new value_type[m_capacity];
-
-    // Copy the existing elements to the new array
-    for (size_type i = 0; i < m_count; ++i) {
-        *(new_data + i) = *(m_data + i);
-    }
-
-    // add the new value to the end of the array
-    *(new_data + m_count) = value;
-
-    // Delete the old data
-    delete[] m_data;
-
-    // Update the data pointer to point to the new array
-    m_data = new_data;
-// }
-
-    // Add the new value to the end of the array and increment
-    // *(m_data + m_count) = value;
-    m_count += 1;
-
+    // append a range of one element: the array only grows (doubling) once
+    // the spare capacity is exhausted, and value may refer to an element
+    insert(end(), &value, &value + 1);
 }
 
 /// Removes the last element of the container. Calling pop_back on an empty
@@ -509,40 +629,8 @@ void Vector::push_back(const value_type& value) {
 /// memory allocated for the removed element is not freed.
 void Vector::pop_back() {
 
-    pointer new_data;           // set a pointer to a new array
-
-    // clean slate
-    new_data = nullptr;
-
-    // check if capacity is 0
-    if (m_capacity == 0) {
-        m_capacity += 1;
-    }
-    // check if count is at or near capacity
-    if (m_count >= m_capacity) {
-        // double size of capacity
-        m_capacity *= 2;
-    }
-
     if (!empty()) {
-        // Create a new array with the updated capacity
-        new_data = new value_type[m_capacity];
-
-        // Copy the existing elements to the new array
-        for (size_type i = 0; i < (m_count); ++i) {
-            *(new_data + i) = *(m_data + i);
-        }
-
-        // assign a null value to final index
-        *(new_data + m_count) = 'A';
-
-        // Delete the old data
-        delete[] m_data;
-
-        // Update the data pointer to point to the new array
-        m_data = new_data;
-
-        // reduce m_count by 1
+        // reduce m_count by 1, the storage is kept
         m_count -= 1;
     }
 
@@ -556,21 +644,20 @@ void Vector::pop_back() {
 Vector& Vector::operator=(const Vector& other) {
     // TODO(David Tom): copy vector from other
     if (this != &other) {
-        // clean slate
-        m_data = nullptr;
-        m_capacity = 0;
-        m_count = 0;
+        // release the old storage
+        ::deallocate(m_data, m_map, m_map_size);
 
         // assign memory for the temporary pointer
-        m_data = new value_type[other.m_capacity];
+        m_data = ::allocate(other.m_capacity, m_map, m_map_size);
+        m_map_file = false;
 
         // assign values from previous array
         m_count = other.m_count;
         m_capacity = other.m_capacity;
 
         // copy data
-        for (size_type i = 0; i < other.m_count; ++i) {
-            *(m_data + i) = *(other.m_data + i);
+        if (m_count > 0) {
+            std::memcpy(m_data, other.m_data, m_count);
         }
     }
 
@@ -585,28 +672,24 @@ Vector& Vector::operator=(const Vector& other) {
 Vector& Vector::operator=(Vector&& other) {
 
     if (this != &other) {
-        // clean slate
-        m_data = nullptr;
-        m_capacity = 0;
-        m_count = 0;
-
-        // assign memory for the temporary pointer
-        m_data = new value_type[other.m_capacity];
+        // release the old storage
+        ::deallocate(m_data, m_map, m_map_size);
 
-        // assign values from previous array
+        // take over other's storage, a mapping is never copied
+        m_data = other.m_data;
         m_count = other.m_count;
         m_capacity = other.m_capacity;
+        m_map = other.m_map;
+        m_map_size = other.m_map_size;
+        m_map_file = other.m_map_file;
 
-        // copy data
-        for (size_type i = 0; i < other.m_count; ++i) {
-            *(m_data + i) = *(other.m_data + i);
-        }
-
-        // delete other's data
-        other.clear();
+        // leave other empty
         other.m_data = nullptr;
         other.m_count = 0;
         other.m_capacity = 0;
+        other.m_map = nullptr;
+        other.m_map_size = 0;
+        other.m_map_file = false;
     }
 
     return *this;
@@ -619,51 +702,10 @@ Vector& Vector::operator=(Vector&& other) {
 /// @param other The Vector to be appended.
 /// @return A reference to the updated Vector.
 Vector& Vector::operator+=(const Vector& other) {
-    // TODO(David Tom): appends contents of vector to another
-    // push back with value being other's
-    // create copy array, add values to it, delete/rebuild old array,
-    // copy data to old array with new capacity, add new data starting at end
-
-    pointer new_data;           // set a pointer to a new array
-    size_type j = 0;            // used to track index for array2
-
-    // clean slate
-    new_data = nullptr;
-
-    // set new capacity value
-    m_capacity = (m_capacity + other.m_capacity);
-
-    if (this != &other) {
-        // check if size is equal to or near capacity
-        if ((m_count + other.m_count) >= (m_capacity)) {
-            // double size of capacity
-            m_capacity *= 2;
-        }
-
-        // assign memory for the temporary pointer
-        new_data = new value_type[m_capacity];
-
-        // copy data from array1
-        for (size_type i = 0; i < m_count; ++i) {
-            *(new_data + i) = *(m_data + i);
-        }
-
-        // append data from array2
-        // start from end of array1 and beginning of array2 (j = 0)
-        for (size_type i = m_count; i < (m_count + other.m_count); ++i) {
-            *(new_data + i) = *(other.m_data + j);
-            ++j;
-        }
-
-        // delete old data
-        delete[] m_data;
-
-        // update data pointer
-        m_data = new_data;
-
-        // increment m_count
-        m_count = (m_count + other.m_count);
-    }
+    // append other's elements as a single range, growing at most once
+    // (other may be this Vector, the range is copied before the old data is
+    // deleted)
+    insert(end(), other.begin(), other.end());
 
     return *this;
 }
@@ -675,34 +717,52 @@ Vector& Vector::operator+=(const Vector& other) {
 
 /* Non-members */
 
+/// Finds the first position at which the character ranges beginning at
+/// first1 and first2 differ. Identical blocks are skipped with memcmp, which
+/// the C library vectorizes, and only the block that differs is searched
+/// character by character.
+///
+/// @param first1 A pointer to the first character of the first sequence.
+/// @param first2 A pointer to the first character of the second sequence.
+/// @param count  The number of characters in each sequence.
+/// @return       The index of the first mismatching character, or count.
+static Vector::size_type mismatch(Vector::const_pointer first1,
+                                  Vector::const_pointer first2,
+                                  Vector::size_type count) {
+    const Vector::size_type block = 256;    // characters per memcmp block
+    Vector::size_type i = 0;
+
+    while (i + block <= count &&
+           std::memcmp(first1 + i, first2 + i, block) == 0) {
+        i += block;
+    }
+
+    while (i < count && first1[i] == first2[i]) {
+        ++i;
+    }
+
+    return i;
+}
+
 /// Compares two vector objects for equality, i.e., if both the size of lhs
 /// and rhs are equal and each element in lhs has equivalent value in rhs at
 /// the same position.
 /// @param lhs The left-hand side Vector object for comparison.
 /// @param rhs The right-hand side Vector object for comparison.
 /// @return True if the vectors are equal, otherwise false.
+/// @note Vectors of different sizes are rejected without looking at the
+///       characters; otherwise both buffers are compared with one memcmp.
 bool equal(const Vector& lhs, const Vector& rhs) {
-    // TODO(David Tom): compare Vectors' contents in 'lhs' and 'rhs'.
-    bool boolState = true;                       // tracks boolState status
-
     // tracks size for verification
     Vector::size_type const totalSize = lhs.size();
 
-    // verifies size is equal
-    if (totalSize == rhs.size()) {
-        // loop through bags and compare index values
-        for (Vector::size_type i = 0; i < totalSize; ++i) {
-            // compare index values at given position
-            if (lhs.at(i) != rhs.at(i)) {
-                boolState = false;       // assigns boolState if instance occurs
-            }
-        }
-    } else {
-        // if size is not equal set bool to false
-        boolState = false;
+    // vectors of different sizes are never equal
+    if (totalSize != rhs.size()) {
+        return false;
     }
 
-    return boolState;
+    return totalSize == 0 ||
+           std::memcmp(lhs.begin(), rhs.begin(), totalSize) == 0;
 }
 
 /// Equality operator for Vector objects. Compares two Vectors for equality.
@@ -712,28 +772,32 @@ bool equal(const Vector& lhs, const Vector& rhs) {
 /// @return True if the vectors are equal (contain the same elements in the
 /// same order), otherwise false.
 bool operator==(const Vector& lhs, const Vector& rhs) {
-    // TODO(David Tom): compare Vectors' contents in 'lhs' and 'rhs'.
-    bool boolState = true;                       // tracks boolState status
-
-    // tracks size for verification
-    Vector::size_type const totalSize = lhs.size();
+    return equal(lhs, rhs);
+}
 
-    // verifies size is equal
-    if (totalSize == rhs.size()) {
-        // loop through bags and compare index values
-        for (Vector::size_type i = 0; i < totalSize; ++i) {
-            // compare index values at given position
-            if (lhs.at(i) != rhs.at(i)) {
-                boolState = false;       // assigns boolState if instance occurs
-            }
-        }
-    } else {
-        // if size is not equal set bool to false
-        boolState = false;
+/// Compares two vector objects lexicographically: the first mismatching
+/// character decides, and if one vector is a prefix of the other the shorter
+/// one orders first.
+/// @param lhs The left-hand side Vector object for comparison.
+/// @param rhs The right-hand side Vector object for comparison.
+/// @return A negative value if lhs orders before rhs, zero if they are
+///         equal, otherwise a positive value.
+int compare(const Vector& lhs, const Vector& rhs) {
+    // only the common prefix can be compared character by character
+    const Vector::size_type common = lhs.size() < rhs.size() ? lhs.size()
+                                                             : rhs.size();
+    const Vector::size_type pos = mismatch(lhs.begin(), rhs.begin(), common);
+
+    if (pos < common) {
+        return lhs.at(pos) < rhs.at(pos) ? -1 : 1;
     }
 
-    return boolState;
+    // one is a prefix of the other: the shorter vector comes first
+    if (lhs.size() == rhs.size()) {
+        return 0;
+    }
 
+    return lhs.size() < rhs.size() ? -1 : 1;
 }
 
 /* EOF */
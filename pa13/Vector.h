@@ -22,6 +22,7 @@
 #define VECTOR_H
 
 #include <cstddef>  // provides std::size_t
+#include <string>
 
 /// Vector is a sequence container that encapsulates dynamic size arrays.
 ///
@@ -37,6 +38,12 @@
 /// additional memory is exhausted. The total amount of allocated memory can
 /// be queried using capacity() function.
 ///
+/// Besides the heap, a Vector can keep its characters in a memory mapping.
+/// map_file() maps a file copy-on-write, so a sequence of gigabytes is
+/// available without reading it, and buffers of HUGE_PAGE bytes or more are
+/// anonymous mappings backed by transparent huge pages. Both behave like
+/// heap storage through the whole interface.
+///
 /// @note Partial custom implementation of std::vector<int>.
 
 class Vector {
@@ -49,6 +56,10 @@ public:
     using pointer         = value_type*;
     using const_pointer   = const value_type*;
 
+    /// Size of a transparent huge page. Buffers of at least this many
+    /// characters are allocated as anonymous mappings rather than on the heap.
+    static const size_type HUGE_PAGE = size_type(2) << 20;
+
     /* Constructors and Destructor */
 
     /// Constructs the container with count copies of elements with value value.
@@ -71,6 +82,18 @@ public:
     /// Destructs the vector. The used storage is deallocated.
     ~Vector();
 
+    /// Maps the file at path into memory and returns a Vector of its
+    /// characters, without the whitespace surrounding them (e.g., the final
+    /// newline). No character is copied: pages are read on first access and
+    /// a page is only duplicated when it is written to, so the file itself is
+    /// never modified. The mapping is replaced by regular storage the first
+    /// time the Vector grows.
+    /// @note The file must not be truncated while it is mapped.
+    /// @param path The path of the file to map.
+    /// @return     A Vector viewing the contents of the file.
+    /// @throws std::system_error if the file cannot be opened or mapped.
+    static Vector map_file(const std::string& path);
+
     /* Element Access */
 
     /// Returns a reference to the element at specified location pos, with
@@ -114,6 +137,20 @@ public:
     Vector::pointer insert(Vector::const_pointer pos,
                             const Vector::value_type& value);
 
+    /// Inserts the elements in the range (first, last) before pos. The array
+    /// is reallocated at most once for the whole range, and only if the range
+    /// does not fit into the spare capacity; otherwise the tail is shifted in
+    /// place.
+    ///
+    /// @param pos   The position where the elements should be inserted.
+    /// @param first A pointer to the first element to insert.
+    /// @param last  A pointer to one past the last element to insert. The
+    ///              range may only refer to this Vector when pos is end().
+    /// @return      A pointer to the first inserted element.
+    Vector::pointer insert(Vector::const_pointer pos,
+                            Vector::const_pointer first,
+                            Vector::const_pointer last);
+
     /// Erases elements from the Vector at a specified position.
     ///
     /// @param pos The position of the element to be erased.
@@ -135,6 +172,11 @@ public:
     /// @return The current capacity of the container.
     size_type capacity() const;
 
+    /// Checks if the elements live in a memory mapping, i.e., a mapped file or
+    /// a buffer of at least HUGE_PAGE characters.
+    /// @return True if the storage is mapped, false if it is on the heap.
+    bool mapped() const;
+
     /* Modifiers */
 
     /// Erases all elements from the container. After this call, size()
@@ -193,6 +235,9 @@ private:
     pointer   m_data;      ///< Pointer to the dynamic array holding elements
     size_type m_capacity;  ///< Current capacity of the dynamic array
     size_type m_count;     ///< Number of active elements in the array
+    pointer   m_map;       ///< Start of the mapping, nullptr for the heap
+    size_type m_map_size;  ///< Length of the mapping in bytes
+    bool      m_map_file;  ///< True if the mapping is a file, never remapped
 };
 
 // ----------------------------------------------------------------------------
@@ -215,5 +260,14 @@ bool equal(const Vector& lhs, const Vector& rhs);
 /// same order), otherwise false.
 bool operator==(const Vector& lhs, const Vector& rhs);
 
+/// Compares two vector objects lexicographically: the first mismatching
+/// character decides, and if one vector is a prefix of the other the shorter
+/// one orders first.
+/// @param lhs The left-hand side Vector object for comparison.
+/// @param rhs The right-hand side Vector object for comparison.
+/// @return A negative value if lhs orders before rhs, zero if they are
+///         equal, otherwise a positive value.
+int compare(const Vector& lhs, const Vector& rhs);
+
 #endif /* VECTOR_H */
 
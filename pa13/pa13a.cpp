@@ -51,17 +51,25 @@ void printStatistics(const Vector& vector);
 /// -------------------------------------------------------------------------
 /// Main entry-point for this application
 ///
+/// @param argc The number of command line arguments.
+/// @param argv An optional path of a sequence file to map instead of reading
+///             the sequence from the standard input.
 /// @returns Exit-code for the process - 0 for success, else an error code.
 /// -------------------------------------------------------------------------
-int main() {
+int main(int argc, char* argv[]) {
     // Variable declarations(s)
     int exitState;                      // tracks the exit code for the process
     exitState = EXIT_SUCCESS;           // set state to successful run
     Vector vector;                      // constructs object from class
 
     /* ******* Input Phase ************************************************** */
-    // input values using overload stream insertion
-    std::cin >> vector;
+    if (argc > 1) {
+        // map a (large) sequence file instead of copying it
+        vector = Vector::map_file(argv[1]);
+    } else {
+        // input values using overload stream insertion
+        std::cin >> vector;
+    }
 
     // verifiy input and assign exitState if error occurs
     for (Vector::value_type const c : vector) {
@@ -162,10 +170,8 @@ std::istream& operator>>(std::istream& is, Vector& vector) {
     // receive input as a string
     is >> input;
 
-    // loop through vector and push back all values
-    for (Vector::value_type const c : input) {
-        vector.push_back(c);
-    }
+    // append all values at once, growing the vector a single time
+    vector.insert(vector.end(), input.data(), input.data() + input.size());
 
     return is;
 }
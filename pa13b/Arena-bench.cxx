@@ -0,0 +1,193 @@
+/// @file Arena-bench.cxx
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file benchmarks pa13b-style ingestion: a table of score rows is
+/// built one row at a time, each row filled with push_back and then appended
+/// to the table, all scores are summed as pa13b's sum() does, and the whole
+/// table is torn down afterwards. The table is built with the default heap
+/// allocator, with every row drawn from a MonotonicArena, with
+/// SmallVector<int, 16> rows that keep their scores inline, and as a
+/// JaggedVector<int> holding all scores in one array; the build, sum and
+/// teardown times are reported in milliseconds.
+///
+/// Example usage:
+/// @code
+///   g++ -O2 Arena-bench.cxx -o arena-bench
+///   ./arena-bench 1000000 3    # 10^6 rows of 3 scores (default 10^7 rows)
+/// @endcode
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <utility>
+
+#include "Vector.hpp"
+#include "SmallVector.hpp"
+#include "JaggedVector.hpp"
+#include "Arena.hpp"
+
+/// Milliseconds spent building, summing and tearing down one table.
+struct Timing {
+    double build;     ///< Time to ingest all rows
+    double sum;       ///< Time to add up every score of the table
+    double teardown;  ///< Time to destroy the table and release its memory
+};
+
+/// Returns the milliseconds elapsed since start.
+/// @param start The time point to measure from.
+/// @return      The elapsed time, in milliseconds.
+double elapsedMs(std::chrono::steady_clock::time_point start) {
+    const std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+/// Ingests rows rows of cols scores into a fresh table, as pa13b does while
+/// reading its input, sums them row by row, then destroys the table.
+/// @tparam Row  The row type, allocating through ArenaAllocator<int>.
+/// @param rows  The number of rows (students) to ingest.
+/// @param cols  The number of scores per row.
+/// @param arena The arena to draw every row from, or nullptr for the heap.
+/// @return      The build, sum and teardown times.
+template <class Row>
+Timing ingest(std::size_t rows, std::size_t cols, MonotonicArena* arena) {
+    using Table = Vector<Row, ArenaAllocator<Row>>;
+
+    Timing timing;
+    long long checksum = 0;                 // keeps the work observable
+
+    auto start = std::chrono::steady_clock::now();
+    {
+        Table* table = new Table(arena);
+
+        for (std::size_t r = 0; r < rows; ++r) {
+            Row scores(table->get_allocator());
+
+            for (std::size_t c = 0; c < cols; ++c) {
+                scores.push_back(static_cast<int>((r + c) % 101));
+            }
+            table->push_back(std::move(scores));
+        }
+        timing.build = elapsedMs(start);
+
+        // follow every row to its scores
+        start = std::chrono::steady_clock::now();
+        for (std::size_t r = 0; r < table->size(); ++r) {
+            const Row& scores = (*table)[r];
+            for (std::size_t c = 0; c < scores.size(); ++c) {
+                checksum += scores[c];
+            }
+        }
+        timing.sum = elapsedMs(start);
+
+        // teardown covers the rows' destructors and giving the memory back
+        start = std::chrono::steady_clock::now();
+        delete table;
+        if (arena != nullptr) {
+            arena->release();
+        }
+        timing.teardown = elapsedMs(start);
+    }
+
+    // guard the checksum against dead code elimination
+    if (checksum == -1) {
+        std::cerr << checksum << std::endl;
+    }
+
+    return timing;
+}
+
+/// Ingests rows rows of cols scores into a fresh JaggedVector, as pa13b does
+/// while reading its input, sums them in one pass over all values, then
+/// destroys the table.
+/// @param rows The number of rows (students) to ingest.
+/// @param cols The number of scores per row.
+/// @return     The build, sum and teardown times.
+Timing ingestJagged(std::size_t rows, std::size_t cols) {
+    Timing timing;
+    long long checksum = 0;                 // keeps the work observable
+
+    auto start = std::chrono::steady_clock::now();
+    JaggedVector<int>* table = new JaggedVector<int>;
+
+    for (std::size_t r = 0; r < rows; ++r) {
+        table->append_row();
+
+        for (std::size_t c = 0; c < cols; ++c) {
+            table->push_back(static_cast<int>((r + c) % 101));
+        }
+    }
+    timing.build = elapsedMs(start);
+
+    // stream through all scores at once
+    start = std::chrono::steady_clock::now();
+    for (int score : table->values()) {
+        checksum += score;
+    }
+    timing.sum = elapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    delete table;
+    timing.teardown = elapsedMs(start);
+
+    // guard the checksum against dead code elimination
+    if (checksum == -1) {
+        std::cerr << checksum << std::endl;
+    }
+
+    return timing;
+}
+
+/// Prints one line of the report.
+/// @param name   The name of the table layout.
+/// @param timing The times measured for the layout.
+void printTiming(const char* name, const Timing& timing) {
+    std::cout << std::left << std::fixed << std::setprecision(1)
+              << std::setw(12) << name
+              << std::setw(14) << timing.build
+              << std::setw(14) << timing.sum
+              << std::setw(14) << timing.teardown << std::endl;
+}
+
+/// -------------------------------------------------------------------------
+/// Main entry-point for this application
+///
+/// @returns Exit-code for the process - 0 for success, else an error code.
+/// -------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    // number of rows (default 10^7) and scores per row (default 3)
+    const std::size_t rows = argc > 1 ? std::strtoull(argv[1], nullptr, 10)
+                                      : 10000000;
+    const std::size_t cols = argc > 2 ? std::strtoull(argv[2], nullptr, 10)
+                                      : 3;
+
+    using HeapRow  = Vector<int, ArenaAllocator<int>>;
+    using SmallRow = SmallVector<int, 16, ArenaAllocator<int>>;
+
+    const Timing heap = ingest<HeapRow>(rows, cols, nullptr);
+
+    MonotonicArena arena;
+    const Timing pooled = ingest<HeapRow>(rows, cols, &arena);
+
+    const Timing small = ingest<SmallRow>(rows, cols, nullptr);
+
+    const Timing jagged = ingestJagged(rows, cols);
+
+    std::cout << rows << " rows x " << cols << " scores" << std::endl
+              << std::left
+              << std::setw(12) << "layout"
+              << std::setw(14) << "build"
+              << std::setw(14) << "sum"
+              << std::setw(14) << "teardown"
+              << "(ms)" << std::endl;
+    printTiming("heap", heap);
+    printTiming("arena", pooled);
+    printTiming("inline16", small);
+    printTiming("jagged", jagged);
+
+    return EXIT_SUCCESS;
+}
+
+// EOF: Arena-bench.cxx
@@ -0,0 +1,261 @@
+/// @file Arena.hpp
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file declares a monotonic arena and an allocator adaptor that
+/// lets any Vector take its storage from the arena. Memory is handed out by
+/// bumping a cursor through a few large blocks and is only given back when the
+/// arena itself is released, so nested vectors built from one input end up
+/// next to each other and are all freed together.
+///
+/// Example usage:
+/// @code
+///   MonotonicArena arena;
+///   Vector<int, ArenaAllocator<int>> v{ArenaAllocator<int>(&arena)};
+/// @endcode
+
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+/// MonotonicArena is a memory resource that only ever grows. Each allocation
+/// is carved out of the current block; when the block is exhausted a new one,
+/// twice as large as the previous (up to MAX_BLOCK), is requested from the
+/// heap. Individual deallocations are ignored and all blocks are freed by
+/// release() or by the destructor.
+class MonotonicArena {
+public:
+    /// Block size beyond which the arena stops doubling, bounding the unused
+    /// tail of the last block.
+    static const std::size_t MAX_BLOCK = std::size_t(64) << 20;
+
+    /// Constructs an empty arena. No memory is requested until the first
+    /// allocation.
+    /// @param initial_size The size of the first block, in bytes; sizes
+    ///                     below a block header are raised to one.
+    explicit MonotonicArena(std::size_t initial_size = 4096) noexcept;
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    /// Destructs the arena. All blocks are released.
+    ~MonotonicArena();
+
+    /// Returns bytes bytes of storage aligned to alignment.
+    /// @param bytes     The number of bytes to allocate.
+    /// @param alignment The alignment of the storage, a power of two.
+    /// @return          A pointer to the storage.
+    void* allocate(std::size_t bytes,
+                   std::size_t alignment = alignof(std::max_align_t));
+
+    /// Frees every block owned by the arena. All pointers handed out by the
+    /// arena become invalid.
+    void release() noexcept;
+
+    /// Returns the number of blocks currently owned by the arena.
+    /// @return The number of blocks.
+    std::size_t blocks() const noexcept;
+
+    /// Returns the total size of the blocks owned by the arena.
+    /// @return The number of bytes reserved from the heap.
+    std::size_t reserved() const noexcept;
+
+private:
+    /// Header placed at the front of every block.
+    struct Block {
+        Block*      next;  ///< Previously allocated block
+        std::size_t size;  ///< Size of the block, header included
+    };
+
+    Block*      m_head;       ///< Most recently allocated block
+    char*       m_cursor;     ///< Next free byte of the current block
+    char*       m_end;        ///< One past the last byte of the current block
+    std::size_t m_next_size;  ///< Size of the next block to allocate
+    std::size_t m_blocks;     ///< Number of blocks owned
+    std::size_t m_reserved;   ///< Total bytes owned
+};
+
+/// ArenaAllocator is a standard allocator that draws from a MonotonicArena.
+/// Copies of the allocator (including rebound ones) share the arena, so a
+/// Vector of Vectors can hand its allocator down to every row. A default
+/// constructed allocator has no arena and falls back to the global heap.
+///
+/// @tparam T Type of the elements to allocate.
+template <class T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    // the arena outlives the containers: always carry it along
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+
+    /// Constructs an allocator that uses the global heap.
+    ArenaAllocator() noexcept : m_arena(nullptr) {}
+
+    /// Constructs an allocator that draws from arena.
+    /// @param arena The arena to allocate from (nullptr for the heap).
+    ArenaAllocator(MonotonicArena* arena) noexcept : m_arena(arena) {}
+
+    /// Constructs an allocator sharing the arena of other.
+    /// @param other An allocator for another element type.
+    template <class U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+        : m_arena(other.arena()) {}
+
+    /// Allocates uninitialized storage for count elements.
+    /// @param count The number of elements.
+    /// @return      A pointer to the storage.
+    T* allocate(std::size_t count);
+
+    /// Releases storage obtained from allocate. This is a no-op for arena
+    /// storage, which is only freed together with the arena.
+    /// @param storage A pointer to the storage.
+    /// @param count   The number of elements the storage was allocated for.
+    void deallocate(T* storage, std::size_t count) noexcept;
+
+    /// Returns the arena of this allocator.
+    /// @return A pointer to the arena, or nullptr for the heap.
+    MonotonicArena* arena() const noexcept { return m_arena; }
+
+private:
+    MonotonicArena* m_arena;  ///< Arena to draw from, nullptr for the heap
+};
+
+/// Compares two allocators. They are equal if they share the same arena, i.e.
+/// storage from one can be released by the other.
+template <class T, class U>
+bool operator==(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) {
+    return lhs.arena() == rhs.arena();
+}
+
+/// Compares two allocators for inequality.
+template <class T, class U>
+bool operator!=(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) {
+    return !(lhs == rhs);
+}
+
+// ----------------------------------------------------------------------------
+
+/// Constructs an empty arena. No memory is requested until the first
+/// allocation.
+/// @param initial_size The size of the first block, in bytes. It is raised
+///                     to the size of a block header, so that doubling it
+///                     always grows it.
+inline MonotonicArena::MonotonicArena(std::size_t initial_size) noexcept
+    : m_head(nullptr), m_cursor(nullptr), m_end(nullptr),
+      m_next_size(initial_size > sizeof(Block) ? initial_size : sizeof(Block)),
+      m_blocks(0), m_reserved(0) {}
+
+/// Destructs the arena. All blocks are released.
+inline MonotonicArena::~MonotonicArena() {
+    release();
+}
+
+/// Returns bytes bytes of storage aligned to alignment.
+/// @param bytes     The number of bytes to allocate.
+/// @param alignment The alignment of the storage, a power of two.
+/// @return          A pointer to the storage.
+inline void* MonotonicArena::allocate(std::size_t bytes,
+                                      std::size_t alignment) {
+    // round the cursor up to the requested alignment
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(m_cursor);
+    std::size_t padding = (alignment - address % alignment) % alignment;
+
+    if (m_cursor == nullptr ||
+        bytes + padding > static_cast<std::size_t>(m_end - m_cursor)) {
+        // the current block is exhausted: grow geometrically, but always
+        // leave room for the header, the request and its alignment
+        if (bytes > SIZE_MAX - sizeof(Block) - alignment) {
+            throw std::bad_alloc();
+        }
+
+        std::size_t size = m_next_size;
+        const std::size_t needed = sizeof(Block) + bytes + alignment;
+        while (size < needed) {
+            // take needed itself where doubling would overflow
+            size = size <= needed / 2 ? size * 2 : needed;
+        }
+
+        Block* block = static_cast<Block*>(::operator new(size));
+        block->next = m_head;
+        block->size = size;
+
+        m_head       = block;
+        m_cursor     = reinterpret_cast<char*>(block + 1);
+        m_end        = reinterpret_cast<char*>(block) + size;
+        m_next_size  = size < MAX_BLOCK ? size * 2 : size;
+        m_blocks    += 1;
+        m_reserved  += size;
+
+        address = reinterpret_cast<std::uintptr_t>(m_cursor);
+        padding = (alignment - address % alignment) % alignment;
+    }
+
+    // bump the cursor past the allocation
+    void* storage = m_cursor + padding;
+    m_cursor += padding + bytes;
+
+    return storage;
+}
+
+/// Frees every block owned by the arena. All pointers handed out by the
+/// arena become invalid.
+inline void MonotonicArena::release() noexcept {
+    while (m_head != nullptr) {
+        Block* next = m_head->next;
+        ::operator delete(m_head);
+        m_head = next;
+    }
+
+    m_cursor   = nullptr;
+    m_end      = nullptr;
+    m_blocks   = 0;
+    m_reserved = 0;
+}
+
+/// Returns the number of blocks currently owned by the arena.
+/// @return The number of blocks.
+inline std::size_t MonotonicArena::blocks() const noexcept {
+    return m_blocks;
+}
+
+/// Returns the total size of the blocks owned by the arena.
+/// @return The number of bytes reserved from the heap.
+inline std::size_t MonotonicArena::reserved() const noexcept {
+    return m_reserved;
+}
+
+/// Allocates uninitialized storage for count elements.
+/// @param count The number of elements.
+/// @return      A pointer to the storage.
+template <class T>
+T* ArenaAllocator<T>::allocate(std::size_t count) {
+    if (m_arena == nullptr) {
+        return static_cast<T*>(::operator new(count * sizeof(T)));
+    }
+
+    return static_cast<T*>(m_arena->allocate(count * sizeof(T), alignof(T)));
+}
+
+/// Releases storage obtained from allocate. This is a no-op for arena
+/// storage, which is only freed together with the arena.
+/// @param storage A pointer to the storage.
+/// @param count   The number of elements the storage was allocated for.
+template <class T>
+void ArenaAllocator<T>::deallocate(T* storage, std::size_t count) noexcept {
+    static_cast<void>(count);
+
+    if (m_arena == nullptr) {
+        ::operator delete(storage);
+    }
+}
+
+#endif  // ARENA_HPP
+
+// EOF: Arena.hpp
@@ -0,0 +1,212 @@
+/// @file JaggedVector-test.cxx
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file contains Catch2 unit tests for the JaggedVector class:
+/// rows added by append_row(), empty or from a range, and filled by
+/// push_back(), checked row by row against a std::vector of std::vectors, and
+/// values(), which must see every value in row order and write through to
+/// the rows.
+
+#include <cstddef>  // provides std::size_t
+#include <forward_list>
+#include <random>
+#include <string>
+#include <vector>
+
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+
+#include "Arena.hpp"
+#include "JaggedVector.hpp"
+#include "JaggedVector.hpp"  // test include guard
+
+/// Checks that table holds the rows of expected, and that values() holds
+/// their values back to back.
+template <class T, class Alloc>
+static void checkRows(const JaggedVector<T, Alloc>& table,
+                      const std::vector<std::vector<T>>& expected) {
+    REQUIRE(table.size() == expected.size());
+    CHECK(table.empty() == expected.empty());
+
+    std::vector<T> flat;
+    for (std::size_t r = 0; r < expected.size(); ++r) {
+        const auto row = table[r];
+        REQUIRE(row.size() == expected[r].size());
+        CHECK(row.empty() == expected[r].empty());
+        CHECK(std::vector<T>(row.begin(), row.end()) == expected[r]);
+        flat.insert(flat.end(), expected[r].begin(), expected[r].end());
+    }
+
+    const auto values = table.values();
+    REQUIRE(table.value_count() == flat.size());
+    REQUIRE(values.size() == flat.size());
+    CHECK(std::vector<T>(values.begin(), values.end()) == flat);
+}
+
+// Test adding rows
+TEST_CASE("JaggedVector append_row()", "[JaggedVector]") {
+    JaggedVector<int> table;
+    std::vector<std::vector<int>> expected;
+
+    SECTION("empty table") {
+        checkRows(table, expected);
+        CHECK(table.values().empty());
+        CHECK(table.values().begin() == table.values().end());
+    }
+
+    SECTION("empty rows, then values pushed to the last row") {
+        table.append_row();
+        table.append_row();
+        table.push_back(1);
+        table.push_back(2);
+        table.append_row();
+        table.append_row();
+        int three = 3;
+        table.push_back(three);
+        CHECK(table.emplace_back(4) == 4);
+        expected = {{}, {1, 2}, {}, {3, 4}};
+        checkRows(table, expected);
+        CHECK(table.back().front() == 3);
+        CHECK(table.back().back() == 4);
+        CHECK(table.at(1).at(1) == 2);
+    }
+
+    SECTION("rows from ranges of different iterators") {
+        const int array[] = {1, 2, 3};
+        const std::forward_list<int> list = {4, 5};
+        const std::vector<int> none;
+
+        table.append_row(array, array + 3);
+        table.append_row(list.begin(), list.end());
+        table.append_row(none.begin(), none.end());
+        table.append_row(array + 2, array + 3);
+        table.push_back(6);
+        expected = {{1, 2, 3}, {4, 5}, {}, {3, 6}};
+        checkRows(table, expected);
+    }
+
+    SECTION("many rows of random lengths, mixing both ways") {
+        std::mt19937 random(8);
+        for (int r = 0; r < 2000; ++r) {
+            std::vector<int> row(random() % 12);
+            for (int& value : row) {
+                value = static_cast<int>(random() % 1000);
+            }
+            if (r % 2 == 0) {
+                table.append_row(row.begin(), row.end());
+            } else {
+                table.append_row();
+                for (int value : row) {
+                    table.push_back(value);
+                }
+            }
+            expected.push_back(row);
+        }
+        checkRows(table, expected);
+    }
+
+    SECTION("pop_row() and clear()") {
+        expected = {{1, 2, 3}, {7}, {}, {8, 9}};
+        for (const std::vector<int>& row : expected) {
+            table.append_row(row.begin(), row.end());
+        }
+        table.pop_row();
+        table.pop_row();
+        table.pop_row();
+        table.pop_row();
+        checkRows(table, {});
+
+        table.append_row();
+        table.push_back(5);
+        table.clear();
+        checkRows(table, {});
+        table.append_row();
+        table.push_back(6);
+        checkRows(table, {{6}});
+    }
+
+    SECTION("reserve() keeps the values in place") {
+        table.reserve(100, 1000);
+        table.append_row();
+        table.push_back(0);
+        const int* first = table.values().begin();
+        for (int r = 1; r < 100; ++r) {
+            table.append_row();
+            for (int i = 0; i < 10 && table.value_count() < 1000; ++i) {
+                table.push_back(r);
+            }
+        }
+        CHECK(table.values().begin() == first);
+        CHECK(table.value_count() == 991);
+    }
+}
+
+// Test the view of all values
+TEST_CASE("JaggedVector values()", "[JaggedVector]") {
+    JaggedVector<std::string> table;
+    const std::vector<std::vector<std::string>> rows = {
+        {"a", "b"}, {}, {"c"}, {"d", "e", "f"}};
+    for (const std::vector<std::string>& row : rows) {
+        table.append_row(row.begin(), row.end());
+    }
+
+    SECTION("sees every value in row order") {
+        checkRows(table, rows);
+        std::string joined;
+        for (const std::string& value : table.values()) {
+            joined += value;
+        }
+        CHECK(joined == "abcdef");
+        CHECK(table.values().front() == "a");
+        CHECK(table.values().back() == "f");
+    }
+
+    SECTION("writes through to the rows") {
+        for (std::string& value : table.values()) {
+            value += value;
+        }
+        table.values()[2] = "C";
+        checkRows(table, {{"aa", "bb"}, {}, {"C"}, {"dd", "ee", "ff"}});
+    }
+
+    SECTION("a const table gives a read-only view") {
+        const JaggedVector<std::string>& view = table;
+        RowView<const std::string> values = view.values();
+        CHECK(values.size() == 6);
+        CHECK(values.at(3) == "d");
+
+        // a mutable view converts to a read-only one
+        RowView<const std::string> row = table[3];
+        CHECK(row.size() == 3);
+        CHECK(row[2] == "f");
+    }
+
+    SECTION("rows added later extend the view") {
+        table.append_row();
+        table.push_back("g");
+        CHECK(table.values().size() == 7);
+        CHECK(table.values().back() == "g");
+        table.pop_row();
+        table.pop_row();
+        CHECK(table.values().size() == 3);
+        CHECK(table.values().back() == "c");
+    }
+}
+
+// Test a table allocating from an arena, as pa13b.cpp uses it
+TEST_CASE("JaggedVector from a MonotonicArena", "[JaggedVector]") {
+    MonotonicArena arena;
+    JaggedVector<int, ArenaAllocator<int>> table{ArenaAllocator<int>(&arena)};
+    std::vector<std::vector<int>> expected;
+
+    for (int r = 0; r < 300; ++r) {
+        std::vector<int> row(r % 7, r);
+        table.append_row(row.begin(), row.end());
+        expected.push_back(row);
+    }
+    checkRows(table, expected);
+    CHECK(table.get_allocator() == ArenaAllocator<int>(&arena));
+}
+
+// EOF: JaggedVector-test.cxx
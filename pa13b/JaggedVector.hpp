@@ -0,0 +1,446 @@
+/// @file JaggedVector.hpp
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This header file contains the class "JaggedVector". JaggedVector is
+/// a table of rows of different lengths stored in compressed sparse row
+/// (CSR) form: the values of all rows lie back to back in one contiguous
+/// array and a second array records where each row ends. Walking the whole
+/// table therefore streams through memory linearly instead of following one
+/// pointer per row as a Vector of Vectors does.
+///
+/// Example usage:
+/// @code
+///   JaggedVector<int> scores;
+///   scores.append_row();            // start a new, empty row
+///   scores.push_back(87);           // append to the last row
+///   scores.push_back(92);
+///   int total = 0;
+///   for (int score : scores.values()) {
+///       total += score;
+///   }
+/// @endcode
+
+
+#ifndef JAGGEDVECTOR_HPP
+#define JAGGEDVECTOR_HPP
+
+// header files
+#include <cstddef>  // provides std::size_t
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <cassert>
+
+#include "Vector.hpp"  // storage of the values and the row offsets
+
+
+/// RowView is a non-owning view of a contiguous run of elements, such as one
+/// row of a JaggedVector. It offers the read and element access interface of
+/// Vector. A view is invalidated by any operation that reallocates the
+/// storage it refers to.
+///
+/// @tparam U Type of the elements (const qualified for a read-only view).
+template <class U>
+class RowView {
+public:
+    // Public aliases
+    using size_type       = std::size_t;
+    using value_type      = typename std::remove_const<U>::type;
+    using reference       = U&;
+    using pointer         = U*;
+
+    /// Constructs an empty view.
+    RowView() noexcept : m_first(nullptr), m_count(0) {}
+
+    /// Constructs a view of count elements beginning at first.
+    /// @param first A pointer to the first element of the view.
+    /// @param count The number of elements in the view.
+    RowView(pointer first, size_type count) noexcept
+        : m_first(first), m_count(count) {}
+
+    /// Converts a mutable view into a read-only one.
+    /// @param other The view to convert.
+    template <class V, class = typename std::enable_if<
+                  std::is_convertible<V*, U*>::value>::type>
+    RowView(const RowView<V>& other) noexcept
+        : m_first(other.begin()), m_count(other.size()) {}
+
+    /// Returns a reference to the element at specified location pos, with
+    /// bounds checking.
+    /// @pre pos is within the range of the view (i.e., pos < size())
+    /// @assert pos is within the range of the view.
+    /// @param pos The position of the element to access.
+    /// @return Reference to the element at the specified position.
+    reference at(size_type pos) const {
+        assert((pos < size()));
+
+        return *(m_first + pos);
+    }
+
+    reference operator[](size_type pos) const { return *(m_first + pos); }
+
+    /// Returns a reference to the first element of the view.
+    /// @note Calling front on an empty view causes undefined behavior.
+    reference front() const { return *m_first; }
+
+    /// Returns a reference to the last element of the view.
+    /// @note Calling back on an empty view causes undefined behavior.
+    reference back() const { return *(m_first + (m_count - 1)); }
+
+    /// Returns a pointer to the first element of the view.
+    pointer begin() const { return m_first; }
+
+    /// Returns a pointer to one past the last element of the view.
+    pointer end() const { return m_first + m_count; }
+
+    /// Checks if the view has no elements.
+    bool empty() const { return m_count == 0; }
+
+    /// Returns the number of elements in the view.
+    size_type size() const { return m_count; }
+
+private:
+    pointer   m_first;  ///< First element of the view
+    size_type m_count;  ///< Number of elements in the view
+};
+
+/// JaggedVector is a sequence of rows, each a sequence of values of its own
+/// length.
+///
+/// All values are kept in one Vector in row order and a second Vector stores
+/// the end offset of every row, so row r occupies the values from the end of
+/// row r - 1 up to its own end. Rows are only ever added or removed at the
+/// back, which keeps both arrays append-only. size(), at() and operator[]
+/// refer to rows so that code written for a Vector of Vectors keeps working;
+/// values() views every value of the table at once.
+///
+/// @tparam T     Type of the values.
+/// @tparam Alloc Allocator used for the values and (rebound) for the offsets
+///               (default std::allocator<T>).
+
+template <class T, class Alloc = std::allocator<T>>
+class JaggedVector {
+public:
+    // Public aliases
+    using allocator_type  = Alloc;
+    using size_type       = std::size_t;
+    using value_type      = T;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using pointer         = value_type*;
+    using const_pointer   = const value_type*;
+    using row_type        = RowView<T>;
+    using const_row_type  = RowView<const T>;
+
+    /* Constructors */
+
+    /// Constructs an empty table.
+    JaggedVector() noexcept;
+
+    /// Constructs an empty table that allocates from alloc.
+    /// @param alloc The allocator to use for the values and the offsets.
+    explicit JaggedVector(const allocator_type& alloc) noexcept;
+
+    /* Row Access */
+
+    /// Returns a view of the row at specified location row, with bounds
+    /// checking.
+    /// @pre row is within the range of the table (i.e., row < size())
+    /// @assert row is within the range of the table.
+    /// @param row The position of the row to access.
+    /// @return A view of the values of the row.
+    row_type at(size_type row);
+    const_row_type at(size_type row) const;
+
+    row_type operator[](size_type row);
+    const_row_type operator[](size_type row) const;
+
+    /// Returns a view of the last row.
+    /// @note Calling back on an empty table causes undefined behavior.
+    /// @return A view of the values of the last row.
+    row_type back();
+    const_row_type back() const;
+
+    /// Returns a view of every value of the table, in row order.
+    /// @return A view of all values.
+    row_type values();
+    const_row_type values() const;
+
+    /* Capacity */
+
+    /// Checks if the table has no rows.
+    /// @return True if the table is empty, otherwise false.
+    bool empty() const;
+
+    /// Returns the number of rows in the table.
+    /// @return The number of rows.
+    size_type size() const;
+
+    /// Returns the number of values in all rows of the table.
+    /// @return The number of values.
+    size_type value_count() const;
+
+    /// Reserves storage for at least rows rows holding values values in
+    /// total, so that appending them causes no reallocation.
+    /// @param rows   The number of rows to make room for.
+    /// @param values The number of values to make room for.
+    void reserve(size_type rows, size_type values);
+
+    /* Modifiers */
+
+    /// Erases all rows and values. The capacity is kept.
+    void clear();
+
+    /// Appends a new, empty row to the table. Values are then added to it
+    /// with push_back or emplace_back.
+    void append_row();
+
+    /// Appends a new row holding the values in the range (first, last).
+    /// The value storage grows at most once for the whole row.
+    ///
+    /// @param first A forward iterator to the first value of the row.
+    /// @param last  A forward iterator to one past the last value of the row.
+    ///              The range must not refer to values of this table.
+    template <class ForwardIt,
+              class = typename std::iterator_traits<ForwardIt>::pointer>
+    void append_row(ForwardIt first, ForwardIt last);
+
+    /// Appends value to the last row of the table.
+    /// @pre The table has at least one row.
+    /// @param value The value to be appended.
+    void push_back(const value_type& value);
+    void push_back(value_type&& value);
+
+    /// Appends a value constructed in place from args to the last row.
+    /// @pre The table has at least one row.
+    /// @param args The arguments forwarded to the constructor of the value.
+    /// @return     A reference to the new value.
+    template <class... Args>
+    reference emplace_back(Args&&... args);
+
+    /// Removes the last row and its values. Calling pop_row on an empty table
+    /// results in undefined behavior.
+    void pop_row();
+
+    /// Returns the allocator associated with the table.
+    /// @return A copy of the allocator.
+    allocator_type get_allocator() const;
+
+private:
+    using offset_allocator = typename std::allocator_traits<
+        Alloc>::template rebind_alloc<size_type>;
+
+    /// Returns the offset of the first value of the row.
+    /// @param row The position of the row.
+    size_type row_begin(size_type row) const;
+
+    Vector<T, Alloc>                    m_values;   ///< Values, row by row
+    Vector<size_type, offset_allocator> m_offsets;  ///< End offset of each row
+};
+
+
+/* Constructors */
+
+/// Constructs an empty table.
+template <class T, class Alloc>
+JaggedVector<T, Alloc>::JaggedVector() noexcept
+    : m_values(), m_offsets() {}
+
+/// Constructs an empty table that allocates from alloc.
+/// @param alloc The allocator to use for the values and the offsets.
+template <class T, class Alloc>
+JaggedVector<T, Alloc>::JaggedVector(const allocator_type& alloc) noexcept
+    : m_values(alloc), m_offsets(offset_allocator(alloc)) {}
+
+/* Row Access */
+
+/// Returns a view of the row at specified location row, with bounds
+/// checking.
+/// @pre row is within the range of the table (i.e., row < size())
+/// @assert row is within the range of the table.
+/// @param row The position of the row to access.
+/// @return A view of the values of the row.
+template <class T, class Alloc>
+typename JaggedVector<T, Alloc>::row_type
+JaggedVector<T, Alloc>::at(size_type row) {
+    assert((row < size()));
+
+    return (*this)[row];
+}
+
+template <class T, class Alloc>
+typename JaggedVector<T, Alloc>::const_row_type
+JaggedVector<T, Alloc>::at(size_type row) const {
+    assert((row < size()));
+
+    return (*this)[row];
+}
+
+template <class T, class Alloc>
+typename JaggedVector<T, Alloc>::row_type
+JaggedVector<T, Alloc>::operator[](size_type row) {
+    const size_type first = row_begin(row);
+
+    return row_type(m_values.begin() + first, m_offsets[row] - first);
+}
+
+template <class T, class Alloc>
+typename JaggedVector<T, Alloc>::const_row_type
+JaggedVector<T, Alloc>::operator[](size_type row) const {
+    const size_type first = row_begin(row);
+
+    return const_row_type(m_values.begin() + first, m_offsets[row] - first);
+}
+
+/// Returns a view of the last row.
+/// @note Calling back on an empty table causes undefined behavior.
+/// @return A view of the values of the last row.
+template <class T, class Alloc>
+typename JaggedVector<T, Alloc>::row_type JaggedVector<T, Alloc>::back() {
+    return (*this)[size() - 1];
+}
+
+template <class T, class Alloc>
+typename JaggedVector<T, Alloc>::const_row_type
+JaggedVector<T, Alloc>::back() const {
+    return (*this)[size() - 1];
+}
+
+/// Returns a view of every value of the table, in row order.
+/// @return A view of all values.
+template <class T, class Alloc>
+typename JaggedVector<T, Alloc>::row_type JaggedVector<T, Alloc>::values() {
+    return row_type(m_values.begin(), m_values.size());
+}
+
+template <class T, class Alloc>
+typename JaggedVector<T, Alloc>::const_row_type
+JaggedVector<T, Alloc>::values() const {
+    return const_row_type(m_values.begin(), m_values.size());
+}
+
+/* Capacity */
+
+/// Checks if the table has no rows.
+/// @return True if the table is empty, otherwise false.
+template <class T, class Alloc>
+bool JaggedVector<T, Alloc>::empty() const {
+    return m_offsets.empty();
+}
+
+/// Returns the number of rows in the table.
+/// @return The number of rows.
+template <class T, class Alloc>
+typename JaggedVector<T, Alloc>::size_type
+JaggedVector<T, Alloc>::size() const {
+    return m_offsets.size();
+}
+
+/// Returns the number of values in all rows of the table.
+/// @return The number of values.
+template <class T, class Alloc>
+typename JaggedVector<T, Alloc>::size_type
+JaggedVector<T, Alloc>::value_count() const {
+    return m_values.size();
+}
+
+/// Reserves storage for at least rows rows holding values values in
+/// total, so that appending them causes no reallocation.
+/// @param rows   The number of rows to make room for.
+/// @param values The number of values to make room for.
+template <class T, class Alloc>
+void JaggedVector<T, Alloc>::reserve(size_type rows, size_type values) {
+    m_offsets.reserve(rows);
+    m_values.reserve(values);
+}
+
+/* Modifiers */
+
+/// Erases all rows and values. The capacity is kept.
+template <class T, class Alloc>
+void JaggedVector<T, Alloc>::clear() {
+    m_values.clear();
+    m_offsets.clear();
+}
+
+/// Appends a new, empty row to the table. Values are then added to it
+/// with push_back or emplace_back.
+template <class T, class Alloc>
+void JaggedVector<T, Alloc>::append_row() {
+    m_offsets.push_back(m_values.size());
+}
+
+/// Appends a new row holding the values in the range (first, last).
+/// The value storage grows at most once for the whole row.
+///
+/// @param first A forward iterator to the first value of the row.
+/// @param last  A forward iterator to one past the last value of the row.
+///              The range must not refer to values of this table.
+template <class T, class Alloc>
+template <class ForwardIt, class>
+void JaggedVector<T, Alloc>::append_row(ForwardIt first, ForwardIt last) {
+    m_values.insert(m_values.end(), first, last);
+    m_offsets.push_back(m_values.size());
+}
+
+/// Appends value to the last row of the table.
+/// @pre The table has at least one row.
+/// @param value The value to be appended.
+template <class T, class Alloc>
+void JaggedVector<T, Alloc>::push_back(const value_type& value) {
+    emplace_back(value);
+}
+
+template <class T, class Alloc>
+void JaggedVector<T, Alloc>::push_back(value_type&& value) {
+    emplace_back(std::move(value));
+}
+
+/// Appends a value constructed in place from args to the last row.
+/// @pre The table has at least one row.
+/// @param args The arguments forwarded to the constructor of the value.
+/// @return     A reference to the new value.
+template <class T, class Alloc>
+template <class... Args>
+typename JaggedVector<T, Alloc>::reference
+JaggedVector<T, Alloc>::emplace_back(Args&&... args) {
+    assert((!empty()));
+
+    // the last row always ends at the end of the values
+    reference value = m_values.emplace_back(std::forward<Args>(args)...);
+    m_offsets[m_offsets.size() - 1] += 1;
+
+    return value;
+}
+
+/// Removes the last row and its values. Calling pop_row on an empty table
+/// results in undefined behavior.
+template <class T, class Alloc>
+void JaggedVector<T, Alloc>::pop_row() {
+    m_values.erase(m_values.begin() + row_begin(size() - 1), m_values.end());
+    m_offsets.pop_back();
+}
+
+/// Returns the allocator associated with the table.
+/// @return A copy of the allocator.
+template <class T, class Alloc>
+typename JaggedVector<T, Alloc>::allocator_type
+JaggedVector<T, Alloc>::get_allocator() const {
+    return m_values.get_allocator();
+}
+
+/* Private */
+
+/// Returns the offset of the first value of the row.
+/// @param row The position of the row.
+template <class T, class Alloc>
+typename JaggedVector<T, Alloc>::size_type
+JaggedVector<T, Alloc>::row_begin(size_type row) const {
+    return row == 0 ? 0 : m_offsets[row - 1];
+}
+
+#endif  // JAGGEDVECTOR_HPP
+
+// EOF: JaggedVector.hpp
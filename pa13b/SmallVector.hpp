@@ -0,0 +1,1062 @@
+/// @file SmallVector.hpp
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This header file contains the class "SmallVector". SmallVector is a
+/// sequence container with the interface of Vector that keeps up to N elements
+/// in a buffer inside the object itself and only spills to the heap once more
+/// than N elements are stored. Short rows therefore cost no allocation at all,
+/// and a Vector of SmallVectors stores each short row directly in the outer
+/// array.
+///
+/// Example usage:
+/// @code
+///   Vector<SmallVector<int, 16>> rows;
+///   SmallVector<int, 16> row;
+///   row.push_back(87);              // stored inline, no allocation
+///   rows.push_back(std::move(row));
+/// @endcode
+
+
+#ifndef SMALLVECTOR_HPP
+#define SMALLVECTOR_HPP
+
+// header files
+#include <cstddef>  // provides std::size_t
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <cassert>
+
+#include "Vector.hpp"  // provides GrowthFactor and the storage helpers
+
+
+/// SmallVector is a sequence container that encapsulates dynamic size arrays
+/// with a small inline buffer.
+///
+/// The elements are stored contiguously, either in the inline buffer (while
+/// size() does not exceed N) or in a heap array obtained from Alloc. Moving
+/// to the heap happens when the inline buffer is exhausted, after which the
+/// container grows like Vector. shrink_to_fit() moves the elements back
+/// inline when they fit again. capacity() is never less than N. The heap
+/// array is tracked by a pointer that is null while the elements are inline,
+/// rather than by a pointer into the object itself, so that the container
+/// stays trivially relocatable.
+///
+/// @note Moving a SmallVector whose elements are inline moves each element,
+///       so pointers into the moved-from container are not carried over.
+///
+/// @tparam T      Type of the elements.
+/// @tparam N      Number of elements stored inline.
+/// @tparam Alloc  Allocator used once the elements spill to the heap
+///                (default std::allocator<T>).
+/// @tparam Growth Growth policy used when the capacity is exhausted
+///                (default GrowthFactor<2, 1>, i.e., doubling).
+
+template <class T, std::size_t N, class Alloc = std::allocator<T>,
+          class Growth = GrowthFactor<>>
+class SmallVector {
+    static_assert(N > 0, "SmallVector needs room for at least one element");
+
+    using alloc_traits = std::allocator_traits<Alloc>;
+
+public:
+    // Public aliases
+    using allocator_type  = Alloc;
+    using size_type       = std::size_t;
+    using value_type      = T;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using pointer         = value_type*;
+    using const_pointer   = const value_type*;
+
+    /* Constructors and Destructor */
+
+    /// Constructs an empty container using the inline buffer.
+    SmallVector() noexcept;
+
+    /// Constructs an empty container that spills into memory from alloc.
+    /// @param alloc The allocator to use once the inline buffer is full.
+    explicit SmallVector(const allocator_type& alloc) noexcept;
+
+    /// Constructs the container with count copies of elements with value value.
+    /// @param count The number of elements to be constructed in the vector.
+    /// @param value The value to initialize each element with (default value).
+    /// @param alloc The allocator to use once the inline buffer is full.
+    SmallVector(size_type count, const value_type& value = value_type{},
+                const allocator_type& alloc = allocator_type());
+
+    /// Copy constructor. Constructs the container with the copy of the contents
+    /// of other.
+    /// @param other Another SmallVector object to copy from.
+    SmallVector(const SmallVector& other);
+
+    /// Move constructor. Heap storage is taken over from other; inline
+    /// elements are moved one by one. other is left empty.
+    /// @param other The SmallVector to be moved.
+    SmallVector(SmallVector&& other) noexcept(
+        std::is_nothrow_move_constructible<T>::value);
+
+    /// Destructs the vector. The heap storage, if any, is deallocated.
+    ~SmallVector();
+
+    /* Element Access */
+
+    /// Returns a reference to the element at specified location pos, with
+    /// bounds checking.
+    /// @pre pos is within the range of the container (i.e., pos < size())
+    /// @assert pos is within the range of the container.
+    /// @param pos The position of the element to access.
+    /// @return Reference to the element at the specified position.
+    reference at(size_type pos);
+    const_reference at(size_type pos) const;
+
+    reference operator[](size_type pos) { return *(begin() + pos); }
+    const_reference operator[](size_type pos) const { return *(begin() + pos); }
+
+    /// Returns a reference to the first element in the container.
+    /// @note Calling front on an empty container causes undefined behavior.
+    /// @return Reference to the first element.
+    reference front();
+    const_reference front() const;
+
+    /// Returns a reference to the last element in the container.
+    /// @note Calling back on an empty container causes undefined behavior.
+    /// @return Reference to the last element.
+    reference back();
+    const_reference back() const;
+
+    /// Returns a pointer to the first element of the vector.
+    /// If the vector is empty, the returned pointer will be equal to end().
+    /// @return Pointer to the first element.
+    pointer begin();
+    const_pointer begin() const;
+
+    /// Returns an pointer to the element following the last element of
+    /// the vector.
+    /// @return Pointer to one past the last element.
+    pointer end();
+    const_pointer end() const;
+
+    /// Inserts value before pos.
+    ///
+    /// @param pos   The position where the element should be inserted.
+    /// @param value The value to be inserted.
+    /// @return      A pointer to the inserted element.
+    pointer insert(const_pointer pos, const value_type& value);
+
+    /// Inserts the elements in the range (first, last) before pos. The storage
+    /// grows at most once for the whole range.
+    ///
+    /// @param pos   The position where the elements should be inserted.
+    /// @param first A forward iterator to the first element to insert.
+    /// @param last  A forward iterator to one past the last element to insert.
+    ///              The range must not refer to elements of this SmallVector.
+    /// @return      A pointer to the first inserted element, or pos if the
+    ///              range is empty.
+    template <class ForwardIt,
+              class = typename std::iterator_traits<ForwardIt>::pointer>
+    pointer insert(const_pointer pos, ForwardIt first, ForwardIt last);
+
+    /// Erases the element at pos.
+    ///
+    /// @param pos The position of the element to be erased.
+    /// @return    A pointer to the element following the erased element.
+    pointer erase(pointer pos);
+
+    /// Erases the elements in the range (first, last). The elements following
+    /// the range are shifted down in place and the capacity is unchanged.
+    ///
+    /// @param first A pointer to the first element to erase.
+    /// @param last  A pointer to one past the last element to erase.
+    /// @return      A pointer to the element following the erased range.
+    pointer erase(pointer first, pointer last);
+
+    /* Capacity */
+
+    /// Checks if the container has no elements, i.e. whether begin() == end().
+    /// @return True if the container is empty, otherwise false.
+    bool empty() const;
+
+    /// Returns the number of elements in the container.
+    /// @return The number of elements in the container.
+    size_type size() const;
+
+    /// Returns the number of elements that the container has currently
+    /// allocated space for; N while the elements are stored inline.
+    /// @return The current capacity of the container.
+    size_type capacity() const;
+
+    /// Checks whether the elements are stored in the inline buffer.
+    /// @return True if no heap storage is in use, otherwise false.
+    bool is_inline() const;
+
+    /// Increases the capacity of the vector to a value that is greater than or
+    /// equal to new_cap. If new_cap is not greater than capacity(), nothing is
+    /// done. Otherwise the elements move to the heap and all pointers and
+    /// references to the elements are invalidated.
+    /// @param new_cap The new capacity of the vector, in number of elements.
+    void reserve(size_type new_cap);
+
+    /// Requests the removal of unused capacity. Heap elements that fit into
+    /// the inline buffer are moved back inline; otherwise capacity() is
+    /// reduced to size().
+    void shrink_to_fit();
+
+    /* Modifiers */
+
+    /// Erases all elements from the container. After this call, size()
+    /// returns zero.
+    void clear();
+
+    /// Appends the given element value to the end of the container. If the
+    /// new size() is greater than capacity(), a reallocation takes place.
+    ///
+    /// @param value The value to be appended to the end of the container.
+    void push_back(const value_type& value);
+    void push_back(value_type&& value);
+
+    /// Appends a new element to the end of the container, constructed in place
+    /// from args.
+    ///
+    /// @param args The arguments forwarded to the constructor of the element.
+    /// @return     A reference to the inserted element.
+    template <class... Args>
+    reference emplace_back(Args&&... args);
+
+    /// Resizes the container to contain count elements, removing surplus
+    /// elements or appending value-initialized elements (or copies of value).
+    ///
+    /// @param count The new size of the container.
+    /// @param value The value to initialize the new elements with.
+    void resize(size_type count);
+    void resize(size_type count, const value_type& value);
+
+    /// Removes the last element of the container. Calling pop_back on an empty
+    /// container results in undefined behavior.
+    void pop_back();
+
+    /// Copy assignment operator. Copies the contents of other into this
+    /// container, reusing the current storage when it is large enough.
+    ///
+    /// @param other The SmallVector to be copied.
+    /// @return A reference to the updated SmallVector.
+    SmallVector& operator=(const SmallVector& other);
+
+    /// Move assignment operator. Heap storage is taken over from other when
+    /// the allocators allow it; inline elements are moved one by one.
+    ///
+    /// @param other The SmallVector to be moved.
+    /// @return A reference to the updated SmallVector.
+    SmallVector& operator=(SmallVector&& other) noexcept(
+        std::is_nothrow_move_constructible<T>::value &&
+        (alloc_traits::propagate_on_container_move_assignment::value ||
+         alloc_traits::is_always_equal::value));
+
+    /// Addition assignment operator. Appends the contents of other.
+    ///
+    /// @param other The SmallVector to be appended.
+    /// @return A reference to the updated SmallVector.
+    SmallVector& operator+=(const SmallVector& other);
+
+    /// Returns the allocator associated with the container.
+    /// @return A copy of the allocator.
+    allocator_type get_allocator() const;
+
+private:
+    /// Returns a pointer to the inline buffer.
+    pointer inline_data();
+    const_pointer inline_data() const;
+
+    /// Grows the storage by the Growth policy so that at least min_reqd
+    /// elements fit without another reallocation.
+    /// @param min_reqd The minimum capacity required by the caller.
+    void grow(size_type min_reqd);
+
+    /// Moves the elements into storage for new_cap elements: the inline
+    /// buffer if new_cap is N, else a new heap array.
+    /// @param new_cap The new capacity, at least size() and at least N.
+    void reallocate(size_type new_cap);
+
+    /// Deallocates the heap storage, if any, and switches back to the inline
+    /// buffer. The elements must already have been destroyed or relocated.
+    void release();
+
+    allocator_type m_alloc;  ///< Allocator of the heap storage
+
+    pointer   m_heap;      ///< Heap array, nullptr while inline
+    size_type m_capacity;  ///< Current capacity, N while inline
+    size_type m_count;     ///< Number of active elements
+
+    alignas(T) unsigned char m_inline[N * sizeof(T)];  ///< Inline buffer
+};
+
+/// A SmallVector never points into itself, so a Vector of SmallVectors can
+/// relocate them with memcpy whenever the elements and the allocator allow.
+template <class T, std::size_t N, class Alloc, class Growth>
+struct is_trivially_relocatable<SmallVector<T, N, Alloc, Growth>>
+    : std::integral_constant<bool, is_trivially_relocatable<T>::value &&
+                                   std::is_trivially_copyable<Alloc>::value> {
+};
+
+// ----------------------------------------------------------------------------
+
+/* Non-members */
+
+/// Compares two SmallVector objects for equality, i.e., if both have the same
+/// size and each element in lhs has equivalent value in rhs at the same
+/// position.
+/// @param lhs The left-hand side SmallVector object for comparison.
+/// @param rhs The right-hand side SmallVector object for comparison.
+/// @return True if the vectors are equal, otherwise false.
+template <class T, std::size_t N, class Alloc, class Growth>
+bool equal(const SmallVector<T, N, Alloc, Growth>& lhs,
+           const SmallVector<T, N, Alloc, Growth>& rhs);
+
+/// Equality operator for SmallVector objects, see equal.
+/// @param lhs The left-hand side SmallVector object for comparison.
+/// @param rhs The right-hand side SmallVector object for comparison.
+/// @return True if the vectors are equal, otherwise false.
+template <class T, std::size_t N, class Alloc, class Growth>
+bool operator==(const SmallVector<T, N, Alloc, Growth>& lhs,
+                const SmallVector<T, N, Alloc, Growth>& rhs);
+
+/// Compares two SmallVector objects lexicographically, see compare for
+/// Vector.
+/// @param lhs The left-hand side SmallVector object for comparison.
+/// @param rhs The right-hand side SmallVector object for comparison.
+/// @return A negative value if lhs orders before rhs, zero if they are
+///         equal, otherwise a positive value.
+template <class T, std::size_t N, class Alloc, class Growth>
+int compare(const SmallVector<T, N, Alloc, Growth>& lhs,
+            const SmallVector<T, N, Alloc, Growth>& rhs);
+
+
+/* Constructors and Destructor */
+
+/// Constructs an empty container using the inline buffer.
+template <class T, std::size_t N, class Alloc, class Growth>
+SmallVector<T, N, Alloc, Growth>::SmallVector() noexcept
+    : m_alloc(), m_heap(nullptr), m_capacity(N), m_count(0) {}
+
+/// Constructs an empty container that spills into memory from alloc.
+/// @param alloc The allocator to use once the inline buffer is full.
+template <class T, std::size_t N, class Alloc, class Growth>
+SmallVector<T, N, Alloc, Growth>::SmallVector(
+    const allocator_type& alloc) noexcept
+    : m_alloc(alloc), m_heap(nullptr), m_capacity(N), m_count(0) {}
+
+/// Constructs the container with count copies of elements with value value.
+/// @param count The number of elements to be constructed in the vector.
+/// @param value The value to initialize each element with (default value).
+/// @param alloc The allocator to use once the inline buffer is full.
+template <class T, std::size_t N, class Alloc, class Growth>
+SmallVector<T, N, Alloc, Growth>::SmallVector(size_type count,
+                                              const value_type& value,
+                                              const allocator_type& alloc)
+    : SmallVector(alloc) {
+    try {
+        resize(count, value);
+    } catch (...) {
+        // the destructor will not run: free what resize() built
+        clear();
+        release();
+        throw;
+    }
+}
+
+/// Copy constructor. Constructs the container with the copy of the contents
+/// of other.
+/// @param other Another SmallVector object to copy from.
+template <class T, std::size_t N, class Alloc, class Growth>
+SmallVector<T, N, Alloc, Growth>::SmallVector(const SmallVector& other)
+    : SmallVector(alloc_traits::select_on_container_copy_construction(
+                  other.m_alloc)) {
+    reserve(other.size());
+
+    try {
+        ::mycopy<T>(m_alloc, other.begin(), other.end(), begin());
+    } catch (...) {
+        // the destructor will not run: free the storage
+        release();
+        throw;
+    }
+    m_count = other.size();
+}
+
+/// Move constructor. Heap storage is taken over from other; inline
+/// elements are moved one by one. other is left empty.
+/// @param other The SmallVector to be moved.
+template <class T, std::size_t N, class Alloc, class Growth>
+SmallVector<T, N, Alloc, Growth>::SmallVector(SmallVector&& other) noexcept(
+    std::is_nothrow_move_constructible<T>::value)
+    : SmallVector(std::move(other.m_alloc)) {
+    if (other.is_inline()) {
+        // the elements live inside other: relocate them into our buffer
+        ::myrelocate<T>(m_alloc, other.begin(), other.end(), begin());
+    } else {
+        // take ownership of other's heap array
+        m_heap     = other.m_heap;
+        m_capacity = other.m_capacity;
+
+        other.m_heap     = nullptr;
+        other.m_capacity = N;
+    }
+
+    m_count       = other.m_count;
+    other.m_count = 0;
+}
+
+/// Destructs the vector. The heap storage, if any, is deallocated.
+template <class T, std::size_t N, class Alloc, class Growth>
+SmallVector<T, N, Alloc, Growth>::~SmallVector() {
+    clear();
+    release();
+}
+
+/* Element Access */
+
+/// Returns a reference to the element at specified location pos, with
+/// bounds checking.
+/// @pre pos is within the range of the container (i.e., pos < size())
+/// @assert pos is within the range of the container.
+/// @param pos The position of the element to access.
+/// @return Reference to the element at the specified position.
+template <class T, std::size_t N, class Alloc, class Growth>
+typename SmallVector<T, N, Alloc, Growth>::reference
+SmallVector<T, N, Alloc, Growth>::at(size_type pos) {
+    assert((pos < size()));
+
+    return *(begin() + pos);
+}
+
+template <class T, std::size_t N, class Alloc, class Growth>
+typename SmallVector<T, N, Alloc, Growth>::const_reference
+SmallVector<T, N, Alloc, Growth>::at(size_type pos) const {
+    assert((pos < size()));
+
+    return *(begin() + pos);
+}
+
+/// Returns a reference to the first element in the container.
+/// @note Calling front on an empty container causes undefined behavior.
+/// @return Reference to the first element.
+template <class T, std::size_t N, class Alloc, class Growth>
+typename SmallVector<T, N, Alloc, Growth>::reference
+SmallVector<T, N, Alloc, Growth>::front() {
+    return *begin();
+}
+
+template <class T, std::size_t N, class Alloc, class Growth>
+typename SmallVector<T, N, Alloc, Growth>::const_reference
+SmallVector<T, N, Alloc, Growth>::front() const {
+    return *begin();
+}
+
+/// Returns a reference to the last element in the container.
+/// @note Calling back on an empty container causes undefined behavior.
+/// @return Reference to the last element.
+template <class T, std::size_t N, class Alloc, class Growth>
+typename SmallVector<T, N, Alloc, Growth>::reference
+SmallVector<T, N, Alloc, Growth>::back() {
+    return *(begin() + (m_count - 1));
+}
+
+template <class T, std::size_t N, class Alloc, class Growth>
+typename SmallVector<T, N, Alloc, Growth>::const_reference
+SmallVector<T, N, Alloc, Growth>::back() const {
+    return *(begin() + (m_count - 1));
+}
+
+/// Returns a pointer to the first element of the vector.
+/// If the vector is empty, the returned pointer will be equal to end().
+/// @return Pointer to the first element.
+template <class T, std::size_t N, class Alloc, class Growth>
+typename SmallVector<T, N, Alloc, Growth>::pointer
+SmallVector<T, N, Alloc, Growth>::begin() {
+    return m_heap != nullptr ? m_heap : inline_data();
+}
+
+template <class T, std::size_t N, class Alloc, class Growth>
+typename SmallVector<T, N, Alloc, Growth>::const_pointer
+SmallVector<T, N, Alloc, Growth>::begin() const {
+    return m_heap != nullptr ? m_heap : inline_data();
+}
+
+/// Returns an pointer to the element following the last element of
+/// the vector.
+/// @return Pointer to one past the last element.
+template <class T, std::size_t N, class Alloc, class Growth>
+typename SmallVector<T, N, Alloc, Growth>::pointer
+SmallVector<T, N, Alloc, Growth>::end() {
+    return begin() + m_count;
+}
+
+template <class T, std::size_t N, class Alloc, class Growth>
+typename SmallVector<T, N, Alloc, Growth>::const_pointer
+SmallVector<T, N, Alloc, Growth>::end() const {
+    return begin() + m_count;
+}
+
+/// Inserts value before pos.
+///
+/// @param pos   The position where the element should be inserted.
+/// @param value The value to be inserted.
+/// @return      A pointer to the inserted element.
+template <class T, std::size_t N, class Alloc, class Growth>
+typename SmallVector<T, N, Alloc, Growth>::pointer
+SmallVector<T, N, Alloc, Growth>::insert(const_pointer pos,
+                                         const value_type& value) {
+    const size_type posIndex = static_cast<size_type>(pos - begin());
+
+    // copy first, value may refer to an element that is moved below
+    value_type copy = value;
+
+    if (m_count == m_capacity) {
+        grow(m_count + 1);
+    }
+
+    if (posIndex == m_count) {
+        alloc_traits::construct(m_alloc, begin() + m_count, std::move(copy));
+    } else {
+        // move the final element into the uninitialized slot at the end
+        alloc_traits::construct(m_alloc, begin() + m_count,
+                                std::move(*(begin() + (m_count - 1))));
+
+        // shift the remaining tail, then assign the value at pos
+        ::mymovebackward<T>(begin() + posIndex, begin() + (m_count - 1),
+                            begin() + m_count);
+        *(begin() + posIndex) = std::move(copy);
+    }
+
+    m_count += 1;
+
+    return (begin() + posIndex);
+}
+
+/// Inserts the elements in the range (first, last) before pos. The storage
+/// grows at most once for the whole range.
+///
+/// @param pos   The position where the elements should be inserted.
+/// @param first A forward iterator to the first element to insert.
+/// @param last  A forward iterator to one past the last element to insert.
+///              The range must not refer to elements of this SmallVector.
+/// @return      A pointer to the first inserted element, or pos if the range
+///              is empty.
+template <class T, std::size_t N, class Alloc, class Growth>
+template <class ForwardIt, class>
+typename SmallVector<T, N, Alloc, Growth>::pointer
+SmallVector<T, N, Alloc, Growth>::insert(const_pointer pos, ForwardIt first,
+                                         ForwardIt last) {
+    // index position and number of elements inserted
+    const size_type posIndex = static_cast<size_type>(pos - begin());
+    const size_type count    = static_cast<size_type>(std::distance(first,
+                                                                    last));
+
+    if (count == 0) {
+        return (begin() + posIndex);
+    }
+
+    if (m_count + count > m_capacity) {
+        grow(m_count + count);
+    }
+
+    // open a gap of count elements within the array
+    const pointer   position = begin() + posIndex;
+    const pointer   old_end  = begin() + m_count;
+    const size_type after    = m_count - posIndex;  // elements after pos
+
+    if (after > count) {
+        // move the final count elements into the uninitialized end
+        for (pointer src = old_end - count, dst = old_end; src != old_end;
+             ++src, ++dst) {
+            alloc_traits::construct(m_alloc, dst, std::move(*src));
+        }
+
+        // shift the rest of the tail and assign the range into the gap
+        ::mymovebackward<T>(position, old_end - count, old_end);
+        for (pointer dst = position; first != last; ++first, ++dst) {
+            *dst = *first;
+        }
+    } else {
+        // the range reaches past the old end: construct its last part
+        ForwardIt mid = first;
+        std::advance(mid, after);
+
+        pointer dst = old_end;
+        for (ForwardIt it = mid; it != last; ++it, ++dst) {
+            alloc_traits::construct(m_alloc, dst, *it);
+        }
+
+        // move the whole tail behind it, then assign the first part
+        for (pointer src = position; src != old_end; ++src, ++dst) {
+            alloc_traits::construct(m_alloc, dst, std::move(*src));
+        }
+        for (dst = position; first != mid; ++first, ++dst) {
+            *dst = *first;
+        }
+    }
+
+    m_count += count;
+
+    return position;
+}
+
+/// Erases the element at pos.
+///
+/// @param pos The position of the element to be erased.
+/// @return    A pointer to the element following the erased element.
+template <class T, std::size_t N, class Alloc, class Growth>
+typename SmallVector<T, N, Alloc, Growth>::pointer
+SmallVector<T, N, Alloc, Growth>::erase(pointer pos) {
+    if (pos < begin() + m_count) {
+        erase(pos, pos + 1);
+    }
+
+    return pos;
+}
+
+/// Erases the elements in the range (first, last). The elements following
+/// the range are shifted down in place and the capacity is unchanged.
+///
+/// @param first A pointer to the first element to erase.
+/// @param last  A pointer to one past the last element to erase.
+/// @return      A pointer to the element following the erased range.
+template <class T, std::size_t N, class Alloc, class Growth>
+typename SmallVector<T, N, Alloc, Growth>::pointer
+SmallVector<T, N, Alloc, Growth>::erase(pointer first, pointer last) {
+    assert((begin() <= first && first <= last && last <= begin() + m_count));
+
+    if (first != last) {
+        // shift the tail down over the erased range
+        const pointer new_end = ::mymove<T>(last, begin() + m_count, first);
+
+        // destroy the moved-from elements left at the end
+        ::mydestroy<T>(m_alloc, new_end, begin() + m_count);
+
+        m_count -= static_cast<size_type>(last - first);
+    }
+
+    return first;
+}
+
+/* Capacity */
+
+/// Checks if the container has no elements, i.e. whether begin() == end().
+/// @return True if the container is empty, otherwise false.
+template <class T, std::size_t N, class Alloc, class Growth>
+bool SmallVector<T, N, Alloc, Growth>::empty() const {
+    return m_count == 0;
+}
+
+/// Returns the number of elements in the container.
+/// @return The number of elements in the container.
+template <class T, std::size_t N, class Alloc, class Growth>
+typename SmallVector<T, N, Alloc, Growth>::size_type
+SmallVector<T, N, Alloc, Growth>::size() const {
+    return m_count;
+}
+
+/// Returns the number of elements that the container has currently
+/// allocated space for; N while the elements are stored inline.
+/// @return The current capacity of the container.
+template <class T, std::size_t N, class Alloc, class Growth>
+typename SmallVector<T, N, Alloc, Growth>::size_type
+SmallVector<T, N, Alloc, Growth>::capacity() const {
+    return m_capacity;
+}
+
+/// Checks whether the elements are stored in the inline buffer.
+/// @return True if no heap storage is in use, otherwise false.
+template <class T, std::size_t N, class Alloc, class Growth>
+bool SmallVector<T, N, Alloc, Growth>::is_inline() const {
+    return m_heap == nullptr;
+}
+
+/// Increases the capacity of the vector to a value that is greater than or
+/// equal to new_cap. If new_cap is not greater than capacity(), nothing is
+/// done. Otherwise the elements move to the heap and all pointers and
+/// references to the elements are invalidated.
+/// @param new_cap The new capacity of the vector, in number of elements.
+template <class T, std::size_t N, class Alloc, class Growth>
+void SmallVector<T, N, Alloc, Growth>::reserve(size_type new_cap) {
+    if (new_cap > m_capacity) {
+        reallocate(new_cap);
+    }
+}
+
+/// Requests the removal of unused capacity. Heap elements that fit into
+/// the inline buffer are moved back inline; otherwise capacity() is
+/// reduced to size().
+template <class T, std::size_t N, class Alloc, class Growth>
+void SmallVector<T, N, Alloc, Growth>::shrink_to_fit() {
+    if (!is_inline() && m_count < m_capacity) {
+        reallocate(m_count > N ? m_count : N);
+    }
+}
+
+/// Grows the storage by the Growth policy so that at least min_reqd
+/// elements fit without another reallocation.
+/// @param min_reqd The minimum capacity required by the caller.
+template <class T, std::size_t N, class Alloc, class Growth>
+void SmallVector<T, N, Alloc, Growth>::grow(size_type min_reqd) {
+    reserve(Growth::next(m_capacity, min_reqd));
+}
+
+/* Modifiers */
+
+/// Erases all elements from the container. After this call, size()
+/// returns zero.
+template <class T, std::size_t N, class Alloc, class Growth>
+void SmallVector<T, N, Alloc, Growth>::clear() {
+    // destroy the live elements, the storage is kept for reuse
+    ::mydestroy<T>(m_alloc, begin(), begin() + m_count);
+
+    m_count = 0;
+}
+
+/// Appends the given element value to the end of the container. If the
+/// new size() is greater than capacity(), a reallocation takes place.
+///
+/// @param value The value to be appended to the end of the container.
+template <class T, std::size_t N, class Alloc, class Growth>
+void SmallVector<T, N, Alloc, Growth>::push_back(const value_type& value) {
+    emplace_back(value);
+}
+
+template <class T, std::size_t N, class Alloc, class Growth>
+void SmallVector<T, N, Alloc, Growth>::push_back(value_type&& value) {
+    emplace_back(std::move(value));
+}
+
+/// Appends a new element to the end of the container, constructed in place
+/// from args.
+///
+/// @param args The arguments forwarded to the constructor of the element.
+/// @return     A reference to the inserted element.
+template <class T, std::size_t N, class Alloc, class Growth>
+template <class... Args>
+typename SmallVector<T, N, Alloc, Growth>::reference
+SmallVector<T, N, Alloc, Growth>::emplace_back(Args&&... args) {
+    if (m_count == m_capacity) {
+        const size_type new_capacity = Growth::next(m_capacity, m_count + 1);
+        const pointer   new_data     = ::myallocate<T>(m_alloc, new_capacity);
+
+        try {
+            // construct first, args may refer to an element of this vector
+            alloc_traits::construct(m_alloc, new_data + m_count,
+                                    std::forward<Args>(args)...);
+
+            // relocate the existing elements
+            try {
+                ::myrelocate<T>(m_alloc, begin(), end(), new_data);
+            } catch (...) {
+                alloc_traits::destroy(m_alloc, new_data + m_count);
+                throw;
+            }
+        } catch (...) {
+            // nothing changed: drop the new array and pass the error on
+            ::mydeallocate<T>(m_alloc, new_data, new_capacity);
+            throw;
+        }
+
+        // release the old storage
+        release();
+
+        m_heap     = new_data;
+        m_capacity = new_capacity;
+    } else {
+        // construct the new value at the end of the array
+        alloc_traits::construct(m_alloc, begin() + m_count,
+                                std::forward<Args>(args)...);
+    }
+
+    m_count += 1;
+
+    return *(begin() + (m_count - 1));
+}
+
+/// Resizes the container to contain count elements, removing surplus
+/// elements or appending value-initialized elements.
+///
+/// @param count The new size of the container.
+template <class T, std::size_t N, class Alloc, class Growth>
+void SmallVector<T, N, Alloc, Growth>::resize(size_type count) {
+    if (count < m_count) {
+        ::mydestroy<T>(m_alloc, begin() + count, begin() + m_count);
+        m_count = count;
+    } else if (count > m_count) {
+        reserve(count);
+
+        for (; m_count < count; ++m_count) {
+            alloc_traits::construct(m_alloc, begin() + m_count);
+        }
+    }
+}
+
+/// @param count The new size of the container.
+/// @param value The value to initialize the new elements with.
+template <class T, std::size_t N, class Alloc, class Growth>
+void SmallVector<T, N, Alloc, Growth>::resize(size_type count,
+                                              const value_type& value) {
+    if (count < m_count) {
+        ::mydestroy<T>(m_alloc, begin() + count, begin() + m_count);
+        m_count = count;
+    } else if (count > m_count) {
+        // copy first, value may refer to an element of this vector
+        const value_type copy = value;
+
+        reserve(count);
+
+        for (; m_count < count; ++m_count) {
+            alloc_traits::construct(m_alloc, begin() + m_count, copy);
+        }
+    }
+}
+
+/// Removes the last element of the container. Calling pop_back on an empty
+/// container results in undefined behavior.
+template <class T, std::size_t N, class Alloc, class Growth>
+void SmallVector<T, N, Alloc, Growth>::pop_back() {
+    if (!empty()) {
+        m_count -= 1;
+        ::mydestroy<T>(m_alloc, begin() + m_count, begin() + (m_count + 1));
+    }
+}
+
+/// Copy assignment operator. Copies the contents of other into this
+/// container, reusing the current storage when it is large enough.
+///
+/// @param other The SmallVector to be copied.
+/// @return A reference to the updated SmallVector.
+template <class T, std::size_t N, class Alloc, class Growth>
+SmallVector<T, N, Alloc, Growth>&
+SmallVector<T, N, Alloc, Growth>::operator=(const SmallVector& other) {
+    if (this != &other) {
+        // adopt other's allocator if it propagates; heap memory obtained from
+        // the old allocator must be returned to it first
+        if constexpr (
+            alloc_traits::propagate_on_container_copy_assignment::value) {
+            if (!alloc_traits::is_always_equal::value &&
+                m_alloc != other.m_alloc) {
+                clear();
+                release();
+            }
+            m_alloc = other.m_alloc;
+        }
+
+        // number of live elements that can simply be assigned over
+        const size_type common = size() < other.size() ? size() : other.size();
+
+        if (other.size() > capacity()) {
+            clear();
+            reallocate(other.size());
+        } else {
+            for (size_type i = 0; i < common; ++i) {
+                *(begin() + i) = *(other.begin() + i);
+            }
+        }
+
+        // construct the remaining elements, or destroy the surplus ones
+        if (m_count > other.m_count) {
+            ::mydestroy<T>(m_alloc, begin() + other.m_count, begin() + m_count);
+        } else {
+            ::mycopy<T>(m_alloc, other.begin() + m_count,
+                        other.begin() + other.m_count, begin() + m_count);
+        }
+
+        m_count = other.m_count;
+    }
+
+    return *this;
+}
+
+/// Move assignment operator. Heap storage is taken over from other when
+/// the allocators allow it; inline elements are moved one by one.
+///
+/// @param other The SmallVector to be moved.
+/// @return A reference to the updated SmallVector.
+template <class T, std::size_t N, class Alloc, class Growth>
+SmallVector<T, N, Alloc, Growth>&
+SmallVector<T, N, Alloc, Growth>::operator=(SmallVector&& other) noexcept(
+    std::is_nothrow_move_constructible<T>::value &&
+    (alloc_traits::propagate_on_container_move_assignment::value ||
+     alloc_traits::is_always_equal::value)) {
+    if (this != &other) {
+        clear();
+
+        // whether other's heap array may be taken over
+        bool steal = !other.is_inline();
+
+        if constexpr (
+            alloc_traits::propagate_on_container_move_assignment::value) {
+            release();
+            m_alloc = std::move(other.m_alloc);
+        } else if constexpr (!alloc_traits::is_always_equal::value) {
+            steal = steal && m_alloc == other.m_alloc;
+        }
+
+        if (steal) {
+            release();
+
+            m_heap     = other.m_heap;
+            m_capacity = other.m_capacity;
+
+            other.m_heap     = nullptr;
+            other.m_capacity = N;
+        } else {
+            // move the elements one by one
+            reserve(other.size());
+            ::myrelocate<T>(m_alloc, other.begin(), other.end(), begin());
+        }
+
+        m_count       = other.m_count;
+        other.m_count = 0;
+    }
+
+    return *this;
+}
+
+/// Addition assignment operator. Appends the contents of other.
+///
+/// @param other The SmallVector to be appended.
+/// @return A reference to the updated SmallVector.
+template <class T, std::size_t N, class Alloc, class Growth>
+SmallVector<T, N, Alloc, Growth>&
+SmallVector<T, N, Alloc, Growth>::operator+=(const SmallVector& other) {
+    const size_type min_reqd = size() + other.size();
+
+    if (min_reqd > capacity()) {
+        grow(min_reqd);
+    }
+
+    // other may be this vector: copy only its original elements
+    ::mycopy<T>(m_alloc, other.begin(), other.begin() + (min_reqd - m_count),
+                end());
+    m_count = min_reqd;
+
+    return *this;
+}
+
+/// Returns the allocator associated with the container.
+/// @return A copy of the allocator.
+template <class T, std::size_t N, class Alloc, class Growth>
+typename SmallVector<T, N, Alloc, Growth>::allocator_type
+SmallVector<T, N, Alloc, Growth>::get_allocator() const {
+    return m_alloc;
+}
+
+/* Private */
+
+/// Returns a pointer to the inline buffer.
+template <class T, std::size_t N, class Alloc, class Growth>
+typename SmallVector<T, N, Alloc, Growth>::pointer
+SmallVector<T, N, Alloc, Growth>::inline_data() {
+    return reinterpret_cast<pointer>(m_inline);
+}
+
+template <class T, std::size_t N, class Alloc, class Growth>
+typename SmallVector<T, N, Alloc, Growth>::const_pointer
+SmallVector<T, N, Alloc, Growth>::inline_data() const {
+    return reinterpret_cast<const_pointer>(m_inline);
+}
+
+/// Moves the elements into storage for new_cap elements: the inline
+/// buffer if new_cap is N, else a new heap array. If an element throws
+/// while it moves, the container keeps its elements and storage.
+/// @param new_cap The new capacity, at least size() and at least N.
+template <class T, std::size_t N, class Alloc, class Growth>
+void SmallVector<T, N, Alloc, Growth>::reallocate(size_type new_cap) {
+    const pointer new_data = new_cap > N ? ::myallocate<T>(m_alloc, new_cap)
+                                         : inline_data();
+
+    if (new_data != begin()) {
+        try {
+            ::myrelocate<T>(m_alloc, begin(), end(), new_data);
+        } catch (...) {
+            if (new_cap > N) {
+                ::mydeallocate<T>(m_alloc, new_data, new_cap);
+            }
+            throw;
+        }
+        release();
+
+        if (new_cap > N) {
+            m_heap     = new_data;
+            m_capacity = new_cap;
+        }
+    }
+}
+
+/// Deallocates the heap storage, if any, and switches back to the inline
+/// buffer. The elements must already have been destroyed or relocated.
+template <class T, std::size_t N, class Alloc, class Growth>
+void SmallVector<T, N, Alloc, Growth>::release() {
+    if (!is_inline()) {
+        ::mydeallocate<T>(m_alloc, m_heap, m_capacity);
+
+        m_heap     = nullptr;
+        m_capacity = N;
+    }
+}
+
+/* Non-members */
+
+/// Compares two SmallVector objects for equality, i.e., if both have the same
+/// size and each element in lhs has equivalent value in rhs at the same
+/// position.
+/// @param lhs The left-hand side SmallVector object for comparison.
+/// @param rhs The right-hand side SmallVector object for comparison.
+/// @return True if the vectors are equal, otherwise false.
+template <class T, std::size_t N, class Alloc, class Growth>
+bool equal(const SmallVector<T, N, Alloc, Growth>& lhs,
+           const SmallVector<T, N, Alloc, Growth>& rhs) {
+    // vectors of different sizes are never equal
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+
+    return ::mymismatch<T>(lhs.begin(), rhs.begin(), lhs.size()) ==
+           lhs.size();
+}
+
+/// Equality operator for SmallVector objects, see equal.
+/// @param lhs The left-hand side SmallVector object for comparison.
+/// @param rhs The right-hand side SmallVector object for comparison.
+/// @return True if the vectors are equal, otherwise false.
+template <class T, std::size_t N, class Alloc, class Growth>
+bool operator==(const SmallVector<T, N, Alloc, Growth>& lhs,
+                const SmallVector<T, N, Alloc, Growth>& rhs) {
+    return equal(lhs, rhs);
+}
+
+/// Compares two SmallVector objects lexicographically, see compare for
+/// Vector.
+/// @param lhs The left-hand side SmallVector object for comparison.
+/// @param rhs The right-hand side SmallVector object for comparison.
+/// @return A negative value if lhs orders before rhs, zero if they are
+///         equal, otherwise a positive value.
+template <class T, std::size_t N, class Alloc, class Growth>
+int compare(const SmallVector<T, N, Alloc, Growth>& lhs,
+            const SmallVector<T, N, Alloc, Growth>& rhs) {
+    // only the common prefix can be compared element by element
+    const std::size_t common = lhs.size() < rhs.size() ? lhs.size()
+                                                       : rhs.size();
+    const std::size_t pos = ::mymismatch<T>(lhs.begin(), rhs.begin(), common);
+
+    if (pos < common) {
+        return lhs[pos] < rhs[pos] ? -1 : 1;
+    }
+
+    // one is a prefix of the other: the shorter vector comes first
+    if (lhs.size() == rhs.size()) {
+        return 0;
+    }
+
+    return lhs.size() < rhs.size() ? -1 : 1;
+}
+
+#endif  // SMALLVECTOR_HPP
+
+// EOF: SmallVector.hpp
@@ -23,10 +23,202 @@
 
 // header files
 #include <cstddef>  // provides std::size_t
+#include <cstring>  // provides std::memcmp, std::memcpy, std::memmove
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include <cassert>
 #include <iostream>
 
 
+/// GrowthFactor is the default growth policy of Vector. When an insertion
+/// needs more room than capacity() provides, the capacity is scaled by
+/// Num / Den (or raised to the required size, whichever is larger). Growing
+/// geometrically keeps the amortized cost of push_back constant, since each
+/// element is only copied a bounded number of times over the life of the
+/// container.
+///
+/// A custom policy only needs a static next(current, required) function
+/// returning the new capacity.
+///
+/// @tparam Num The numerator of the growth factor (default 2).
+/// @tparam Den The denominator of the growth factor (default 1).
+template <std::size_t Num = 2, std::size_t Den = 1>
+struct GrowthFactor {
+    static_assert(Den > 0 && Num > Den, "growth factor must be above 1");
+
+    /// Computes the next capacity of a container.
+    /// @param current  The current capacity of the container.
+    /// @param required The minimum capacity needed by the operation.
+    /// @return         The capacity to allocate, never less than required.
+    static std::size_t next(std::size_t current, std::size_t required) {
+        // scale without overflowing for large capacities
+        std::size_t grown = (current / Den) * Num + (current % Den) * Num / Den;
+
+        // always make room for at least one more element
+        if (grown <= current) {
+            grown = current + 1;
+        }
+
+        return grown < required ? required : grown;
+    }
+};  // end struct GrowthFactor
+
+/// is_trivially_relocatable tells Vector whether an object may be moved to a
+/// new address by copying its bytes and forgetting the original, without
+/// running its move constructor and destructor. This holds for all trivially
+/// copyable types; a type that owns its storage without pointing into itself
+/// may specialize the trait so that Vector relocates it with memcpy.
+///
+/// @tparam T The type to query.
+template <class T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+/// is_trivially_comparable tells Vector whether two objects compare equal
+/// exactly when their bytes are equal, so that ranges of them can be compared
+/// with memcmp. This holds for integers, characters, enumerations and
+/// pointers, but not for floating point types (0.0 == -0.0, NaN != NaN). A
+/// type without padding whose operator== compares every member may
+/// specialize the trait.
+///
+/// @tparam T The type to query.
+template <class T>
+struct is_trivially_comparable
+    : std::integral_constant<bool, std::is_integral<T>::value ||
+                                   std::is_enum<T>::value ||
+                                   std::is_pointer<T>::value> {};
+
+#ifdef VECTOR_STATS
+
+/// VectorStats counts the memory traffic of Vector. It is only available when
+/// VECTOR_STATS is defined before Vector.hpp is included (e.g., compiled with
+/// -DVECTOR_STATS); otherwise no counter exists and no event is recorded, so
+/// the hooks cost nothing. Every Vector keeps its own counters, see
+/// Vector::stats(), and all events are also added to vector_global_stats().
+/// The counters are not synchronized between threads.
+struct VectorStats {
+    /// Number of buckets of the growth histogram.
+    static const std::size_t BUCKETS = 64;
+
+    std::size_t allocations   = 0;  ///< Arrays obtained from the allocator
+    std::size_t deallocations = 0;  ///< Arrays returned to the allocator
+    std::size_t reallocations = 0;  ///< Arrays replaced by a resized one
+    std::size_t copies        = 0;  ///< Elements copy constructed or assigned
+    std::size_t moves         = 0;  ///< Elements moved or relocated bytewise
+    std::size_t bytes_moved   = 0;  ///< Bytes of all moved elements
+    std::size_t peak_capacity = 0;  ///< Largest array allocated, in elements
+
+    /// Growth events by the bit width of the new capacity, i.e., bucket b
+    /// counts the reallocations to a capacity in [2^(b-1), 2^b).
+    std::size_t growth[BUCKETS] = {};
+
+    /// Records that an array of capacity elements was allocated.
+    void on_allocate(std::size_t capacity) {
+        if (capacity > 0) {
+            allocations += 1;
+            peak_capacity = capacity > peak_capacity ? capacity
+                                                     : peak_capacity;
+        }
+    }
+
+    /// Records that an array of capacity elements was deallocated.
+    void on_deallocate(std::size_t capacity) {
+        if (capacity > 0) {
+            deallocations += 1;
+        }
+    }
+
+    /// Records that the elements were relocated from an array of old_capacity
+    /// elements into one of new_capacity elements. The first array of a
+    /// Vector only counts as growth.
+    void on_reallocate(std::size_t old_capacity, std::size_t new_capacity) {
+        if (old_capacity > 0) {
+            reallocations += 1;
+        }
+
+        if (new_capacity > old_capacity) {
+            std::size_t bucket = 0;
+            while (bucket + 1 < BUCKETS && (new_capacity >> bucket) != 0) {
+                ++bucket;
+            }
+            growth[bucket] += 1;
+        }
+    }
+
+    /// Records that count elements of type T were copied.
+    template <class T>
+    void on_copy(std::size_t count) {
+        copies += count;
+    }
+
+    /// Records that count elements of type T were moved.
+    template <class T>
+    void on_move(std::size_t count) {
+        moves       += count;
+        bytes_moved += count * sizeof(T);
+    }
+
+    /// Records that count elements of type T were relocated into a new array,
+    /// which copies them when their move constructor may throw (see
+    /// std::move_if_noexcept).
+    template <class T>
+    void on_relocate(std::size_t count) {
+        if (is_trivially_relocatable<T>::value ||
+            std::is_nothrow_move_constructible<T>::value ||
+            !std::is_copy_constructible<T>::value) {
+            on_move<T>(count);
+        } else {
+            on_copy<T>(count);
+        }
+    }
+
+    /// Resets all counters to zero.
+    void reset() { *this = VectorStats(); }
+};
+
+/// Returns the counters shared by all Vectors of the program.
+/// @return A reference to the global counters.
+inline VectorStats& vector_global_stats() {
+    static VectorStats stats;
+    return stats;
+}
+
+/// Prints the counters, one per line, followed by the non-empty buckets of
+/// the growth histogram.
+/// @param os    The stream to print to.
+/// @param stats The counters to print.
+/// @return      The stream.
+inline std::ostream& operator<<(std::ostream& os, const VectorStats& stats) {
+    os << "allocations:   " << stats.allocations << '\n'
+       << "deallocations: " << stats.deallocations << '\n'
+       << "reallocations: " << stats.reallocations << '\n'
+       << "copies:        " << stats.copies << '\n'
+       << "moves:         " << stats.moves << '\n'
+       << "bytes moved:   " << stats.bytes_moved << '\n'
+       << "peak capacity: " << stats.peak_capacity << '\n';
+
+    for (std::size_t b = 0; b < VectorStats::BUCKETS; ++b) {
+        if (stats.growth[b] > 0) {
+            os << "growth to < 2^" << b << ": " << stats.growth[b] << '\n';
+        }
+    }
+
+    return os;
+}
+
+/// Records an event on the counters of this Vector and the global counters.
+#define VECTOR_STATS_RECORD(event) \
+    (m_stats.event, vector_global_stats().event)
+
+#else
+
+/// Records nothing: VECTOR_STATS is not defined.
+#define VECTOR_STATS_RECORD(event) static_cast<void>(0)
+
+#endif  // VECTOR_STATS
+
 /// Vector is a sequence container that encapsulates dynamic size arrays.
 ///
 /// The elements are stored contiguously, which means that elements can be
@@ -42,11 +234,22 @@
 /// be queried using capacity() function.
 ///
 /// @note Partial custom implementation of std::vector<int>.
-
-template <class T>
+///
+/// @tparam T      Type of the elements.
+/// @tparam Alloc  Allocator used to acquire and release the storage and to
+///                construct and destroy the elements (default
+///                std::allocator<T>).
+/// @tparam Growth Growth policy used when the capacity is exhausted
+///                (default GrowthFactor<2, 1>, i.e., doubling).
+
+template <class T, class Alloc = std::allocator<T>,
+          class Growth = GrowthFactor<>>
 class Vector {
+    using alloc_traits = std::allocator_traits<Alloc>;
+
 public:
     // Public aliases
+    using allocator_type  = Alloc;
     using size_type       = std::size_t;
     using value_type      = T;
     using reference       = value_type&;
@@ -56,11 +259,20 @@ public:
 
     /* Constructors and Destructor */
 
+    /// Constructs an empty container. No storage is allocated until the first
+    /// element is inserted.
+    Vector() noexcept;
+
+    /// Constructs an empty container that allocates from alloc.
+    /// @param alloc The allocator to use for all memory of this container.
+    explicit Vector(const allocator_type& alloc) noexcept;
+
     /// Constructs the container with count copies of elements with value value.
-    /// @param count The number of elements to be constructed in the vector
-    /// (default zero).
+    /// @param count The number of elements to be constructed in the vector.
     /// @param value The value to initialize each element with (default value).
-    Vector(size_type count = 0, const value_type& value = value_type{});
+    /// @param alloc The allocator to use for all memory of this container.
+    Vector(size_type count, const value_type& value = value_type{},
+           const allocator_type& alloc = allocator_type());
 
     /// Copy constructor. Constructs the container with the copy of the contents
     /// of other.
@@ -71,7 +283,7 @@ public:
     /// ownership of resources between Vector objects.
     ///
     /// @param other The Vector to be moved.
-    Vector(Vector&& other);
+    Vector(Vector&& other) noexcept;
 
     /// Destructs the vector. The used storage is deallocated.
     ~Vector();
@@ -122,12 +334,36 @@ public:
     Vector::pointer insert(Vector::const_pointer pos,
                             const Vector::value_type& value);
 
+    /// Inserts the elements in the range (first, last) before pos. The storage
+    /// grows at most once for the whole range; if the range fits into the
+    /// spare capacity the tail is shifted in place instead.
+    ///
+    /// @param pos   The position where the elements should be inserted.
+    /// @param first A forward iterator to the first element to insert.
+    /// @param last  A forward iterator to one past the last element to insert.
+    ///              The range must not refer to elements of this Vector.
+    /// @return      A pointer to the first inserted element, or pos if the
+    ///              range is empty.
+    template <class ForwardIt,
+              class = typename std::iterator_traits<ForwardIt>::pointer>
+    Vector::pointer insert(Vector::const_pointer pos, ForwardIt first,
+                           ForwardIt last);
+
     /// Erases elements from the Vector at a specified position.
     ///
     /// @param pos The position of the element to be erased.
     /// @return    A pointer to the elements following the erased element.
     Vector::pointer erase(Vector::pointer pos);
 
+    /// Erases the elements in the range (first, last). The elements following
+    /// the range are shifted down in place (a single memmove for trivially
+    /// copyable types) and the capacity is unchanged.
+    ///
+    /// @param first A pointer to the first element to erase.
+    /// @param last  A pointer to one past the last element to erase.
+    /// @return      A pointer to the element following the erased range.
+    Vector::pointer erase(Vector::pointer first, Vector::pointer last);
+
     /* Capacity */
 
     /// Checks if the container has no elements, i.e. whether begin() == end().
@@ -143,6 +379,18 @@ public:
     /// @return The current capacity of the container.
     size_type capacity() const;
 
+    /// Increases the capacity of the vector to a value that is greater than or
+    /// equal to new_cap. If new_cap is not greater than capacity(), nothing is
+    /// done. Otherwise all pointers and references to the elements are
+    /// invalidated.
+    /// @param new_cap The new capacity of the vector, in number of elements.
+    void reserve(size_type new_cap);
+
+    /// Requests the removal of unused capacity, i.e., reduces capacity() to
+    /// size(). If a reallocation occurs, all pointers and references to the
+    /// elements are invalidated.
+    void shrink_to_fit();
+
     /* Modifiers */
 
     /// Erases all elements from the container. After this call, size()
@@ -162,6 +410,27 @@ public:
     ///
     /// @param value The value to be appended to the end of the container.
     void push_back(const value_type& value);
+    void push_back(value_type&& value);
+
+    /// Appends a new element to the end of the container, constructed in place
+    /// from args. If the new size() is greater than capacity(), a reallocation
+    /// takes place and the existing elements are relocated, which only moves
+    /// them when their move constructor cannot throw.
+    ///
+    /// @param args The arguments forwarded to the constructor of the element.
+    /// @return     A reference to the inserted element.
+    template <class... Args>
+    reference emplace_back(Args&&... args);
+
+    /// Resizes the container to contain count elements. If the current size is
+    /// greater than count, the container is reduced to its first count
+    /// elements. If the current size is less than count, additional
+    /// value-initialized elements (or copies of value) are appended.
+    ///
+    /// @param count The new size of the container.
+    /// @param value The value to initialize the new elements with.
+    void resize(size_type count);
+    void resize(size_type count, const value_type& value);
 
     /// Removes the last element of the container. Calling pop_back on an empty
     /// container results in undefined behavior. Pointers (including the end()
@@ -188,7 +457,9 @@ public:
     ///
     /// @param other The Vector to be moved.
     /// @return A reference to the updated Vector.
-    Vector& operator=(Vector&& other);
+    Vector& operator=(Vector&& other) noexcept(
+        alloc_traits::propagate_on_container_move_assignment::value ||
+        alloc_traits::is_always_equal::value);
 
     /// Addition assignment operator for the Vector class. Appends the contents
     /// of one Vector to another.
@@ -197,12 +468,40 @@ public:
     /// @return A reference to the updated Vector.
     Vector& operator+=(const Vector& other);
 
+    /// Returns the allocator associated with the container.
+    /// @return A copy of the allocator.
+    allocator_type get_allocator() const;
+
+#ifdef VECTOR_STATS
+    /// Returns the memory traffic caused by this Vector since it was
+    /// constructed (only available when VECTOR_STATS is defined).
+    /// @return A reference to the counters of this Vector.
+    const VectorStats& stats() const { return m_stats; }
+#endif
+
 private:
+    /// Grows the storage by the Growth policy so that at least min_reqd
+    /// elements fit without another reallocation.
+    /// @param min_reqd The minimum capacity required by the caller.
+    void grow(size_type min_reqd);
+
+    allocator_type m_alloc;  ///< Allocator of the storage and the elements
+
     pointer   m_data;      ///< Pointer to the dynamic array holding elements
     size_type m_capacity;  ///< Current capacity of the dynamic array
     size_type m_count;     ///< Number of active elements in the array
+
+#ifdef VECTOR_STATS
+    VectorStats m_stats;   ///< Memory traffic caused by this Vector
+#endif
 };
 
+/// A Vector only holds a pointer to its array, so it can be relocated with
+/// memcpy whenever its allocator can.
+template <class T, class Alloc, class Growth>
+struct is_trivially_relocatable<Vector<T, Alloc, Growth>>
+    : std::is_trivially_copyable<Alloc> {};
+
 // ----------------------------------------------------------------------------
 
 /* Non-members */
@@ -213,8 +512,9 @@ private:
 /// @param lhs The left-hand side Vector object for comparison.
 /// @param rhs The right-hand side Vector object for comparison.
 /// @return True if the vectors are equal, otherwise false.
-template <class T>
-bool equal(const Vector<T>& lhs, const Vector<T>& rhs);
+template <class T, class Alloc, class Growth>
+bool equal(const Vector<T, Alloc, Growth>& lhs,
+           const Vector<T, Alloc, Growth>& rhs);
 
 /// Equality operator for Vector objects. Compares two Vectors for equality.
 ///
@@ -222,13 +522,82 @@ bool equal(const Vector<T>& lhs, const Vector<T>& rhs);
 /// @param rhs The right-hand side Vector object for comparison.
 /// @return True if the vectors are equal (contain the same elements in the
 /// same order), otherwise false.
-template <class T>
-bool operator==(const Vector<T>& lhs, const Vector<T>& rhs);
+template <class T, class Alloc, class Growth>
+bool operator==(const Vector<T, Alloc, Growth>& lhs,
+                const Vector<T, Alloc, Growth>& rhs);
+
+/// Compares two vector objects lexicographically: the first mismatching
+/// element decides, and if one vector is a prefix of the other the shorter
+/// one orders first.
+/// @param lhs The left-hand side Vector object for comparison.
+/// @param rhs The right-hand side Vector object for comparison.
+/// @return A negative value if lhs orders before rhs, zero if they are
+///         equal, otherwise a positive value.
+template <class T, class Alloc, class Growth>
+int compare(const Vector<T, Alloc, Growth>& lhs,
+            const Vector<T, Alloc, Growth>& rhs);
+
+
+/// Allocates raw, uninitialized storage for count elements from alloc. No
+/// element is constructed, so the caller must construct each slot before it
+/// is used.
+///
+/// @param alloc The allocator of the container.
+/// @param count The number of elements to make room for.
+/// @return      A pointer to the storage, or nullptr if count is zero.
+template <class T, class Alloc>
+static
+typename Vector<T>::pointer myallocate(Alloc& alloc,
+                       typename Vector<T>::size_type count) {
+    typename Vector<T>::pointer storage = nullptr;
+
+    if (count > 0) {
+        storage = std::allocator_traits<Alloc>::allocate(alloc, count);
+    }
+
+    return storage;
+}
 
+/// Releases storage obtained from myallocate. The elements must already have
+/// been destroyed.
+///
+/// @param alloc   The allocator the storage was obtained from.
+/// @param storage A pointer to the storage (may be nullptr).
+/// @param count   The number of elements the storage was allocated for.
+template <class T, class Alloc>
+static
+void mydeallocate(Alloc& alloc, typename Vector<T>::pointer storage,
+                  typename Vector<T>::size_type count) {
+    if (storage != nullptr) {
+        std::allocator_traits<Alloc>::deallocate(alloc, storage, count);
+    }
+}
+
+/// Destroys the elements in the range, defined by (first, last), leaving the
+/// storage uninitialized. Nothing is done for trivially destructible types.
+///
+/// @param alloc The allocator the elements were constructed with.
+/// @param first A pointer to the first element to destroy.
+/// @param last  A pointer to one past the last element to destroy.
+template <class T, class Alloc>
+static
+void mydestroy(Alloc& alloc, typename Vector<T>::pointer first,
+               typename Vector<T>::pointer last) {
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+        while (first != last) {
+            std::allocator_traits<Alloc>::destroy(alloc, first++);
+        }
+    }
+}
 
 /// Copies the elements in the range, defined by (first, last), to another
-/// range beginning at d_first (copy destination range).
+/// range beginning at d_first (copy destination range). The destination is
+/// uninitialized storage, so each element is copy constructed in place, or
+/// copied with a single memcpy when T is trivially copyable. If a copy
+/// constructor throws, the elements constructed so far are destroyed, so the
+/// destination is uninitialized again.
 ///
+/// @param alloc   The allocator used to construct the copies.
 /// @param first   A pointer to the first element of the source sequence.
 /// @param last    A pointer to one past the last element of source sequence.
 /// @param d_first A pointer to the first element of the destination sequence.
@@ -236,68 +605,311 @@ bool operator==(const Vector<T>& lhs, const Vector<T>& rhs);
 ///                last element copies.
 /// @note CS202 function operator used in lecture to remove final 6 bytes and
 ///       5 blocks of memory leakage in Vector-test2.cxx
-template <class T>
+template <class T, class Alloc>
 static
-typename Vector<T>::pointer mycopy(typename Vector<T>::const_pointer first,
+typename Vector<T>::pointer mycopy(Alloc& alloc,
+                       typename Vector<T>::const_pointer first,
                        typename Vector<T>::const_pointer last,
                        typename Vector<T>::pointer       d_first) {
-    while (first != last) {
-        *d_first++ = *first++;
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        const auto count = static_cast<std::size_t>(last - first);
+
+        if (count > 0) {
+            std::memcpy(d_first, first, count * sizeof(T));
+        }
+        d_first += count;
+    } else {
+        typename Vector<T>::pointer current = d_first;
+
+        try {
+            for (; first != last; ++first, ++current) {
+                std::allocator_traits<Alloc>::construct(alloc, current,
+                                                        *first);
+            }
+        } catch (...) {
+            ::mydestroy<T>(alloc, d_first, current);
+            throw;
+        }
+        d_first = current;
+    }
+
+    return d_first;
+}
+
+/// Constructs the elements in the range, defined by (first, last), into the
+/// uninitialized storage beginning at d_first. Each element is move
+/// constructed if its move constructor cannot throw (copied otherwise, see
+/// std::move_if_noexcept); the source is left to the caller. If a
+/// constructor throws, the elements constructed so far are destroyed, so the
+/// destination is uninitialized again and the source is unchanged.
+///
+/// @param alloc   The allocator of the container.
+/// @param first   A pointer to the first element of the source sequence.
+/// @param last    A pointer to one past the last element of source sequence.
+/// @param d_first A pointer to the first element of the destination sequence.
+/// @return        A pointer to one past the last constructed element.
+template <class T, class Alloc>
+static
+typename Vector<T>::pointer mymoveconstruct(Alloc& alloc,
+                       typename Vector<T>::pointer first,
+                       typename Vector<T>::pointer last,
+                       typename Vector<T>::pointer d_first) {
+    typename Vector<T>::pointer current = d_first;
+
+    try {
+        for (; first != last; ++first, ++current) {
+            std::allocator_traits<Alloc>::construct(alloc, current,
+                                        std::move_if_noexcept(*first));
+        }
+    } catch (...) {
+        ::mydestroy<T>(alloc, d_first, current);
+        throw;
+    }
+
+    return current;
+}
+
+/// Relocates the elements in the range, defined by (first, last), into the
+/// uninitialized storage beginning at d_first. Each element is constructed
+/// as by mymoveconstruct and the source is destroyed once all of them are,
+/// so if a constructor throws, nothing is relocated. Trivially relocatable
+/// types are relocated with a single memcpy.
+///
+/// @param alloc   The allocator of the container.
+/// @param first   A pointer to the first element of the source sequence.
+/// @param last    A pointer to one past the last element of source sequence.
+/// @param d_first A pointer to the first element of the destination sequence.
+/// @return        A pointer to one past the last relocated element.
+template <class T, class Alloc>
+static
+typename Vector<T>::pointer myrelocate(Alloc& alloc,
+                       typename Vector<T>::pointer first,
+                       typename Vector<T>::pointer last,
+                       typename Vector<T>::pointer d_first) {
+    if constexpr (is_trivially_relocatable<T>::value) {
+        const auto count = static_cast<std::size_t>(last - first);
+
+        // the bytes are the object: copy them without calling constructors
+        if (count > 0) {
+            std::memcpy(static_cast<void*>(d_first),
+                        static_cast<const void*>(first), count * sizeof(T));
+        }
+        d_first += count;
+    } else {
+        d_first = ::mymoveconstruct<T>(alloc, first, last, d_first);
+        ::mydestroy<T>(alloc, first, last);
+    }
+
+    return d_first;
+}
+
+/// Relocates the elements in the range, defined by (first, last), into new
+/// storage with a gap before pos: the elements before pos go to d_first and
+/// the rest to d_pos. If a constructor throws, nothing is relocated, as with
+/// myrelocate.
+///
+/// @param alloc   The allocator of the container.
+/// @param first   A pointer to the first element of the source sequence.
+/// @param pos     A pointer to the element of the source sequence to d_pos.
+/// @param last    A pointer to one past the last element of source sequence.
+/// @param d_first A pointer to the first element of the destination sequence.
+/// @param d_pos   A pointer to the destination of the element at pos.
+template <class T, class Alloc>
+static
+void myrelocatearound(Alloc& alloc, typename Vector<T>::pointer first,
+                      typename Vector<T>::pointer pos,
+                      typename Vector<T>::pointer last,
+                      typename Vector<T>::pointer d_first,
+                      typename Vector<T>::pointer d_pos) {
+    if constexpr (is_trivially_relocatable<T>::value) {
+        ::myrelocate<T>(alloc, first, pos, d_first);
+        ::myrelocate<T>(alloc, pos, last, d_pos);
+    } else {
+        const auto d_end = ::mymoveconstruct<T>(alloc, first, pos, d_first);
+
+        try {
+            ::mymoveconstruct<T>(alloc, pos, last, d_pos);
+        } catch (...) {
+            ::mydestroy<T>(alloc, d_first, d_end);
+            throw;
+        }
+
+        ::mydestroy<T>(alloc, first, last);
+    }
+}
+
+/// Moves the elements in the range, defined by (first, last), onto the live
+/// elements beginning at d_first, front to back, so the destination may
+/// overlap the source as long as d_first is not after first. Trivially
+/// copyable types are shifted with a single memmove.
+///
+/// @param first   A pointer to the first element of the source sequence.
+/// @param last    A pointer to one past the last element of source sequence.
+/// @param d_first A pointer to the first element of the destination sequence.
+/// @return        A pointer to one past the last element moved.
+template <class T>
+static
+typename Vector<T>::pointer mymove(typename Vector<T>::pointer first,
+                       typename Vector<T>::pointer last,
+                       typename Vector<T>::pointer d_first) {
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        const auto count = static_cast<std::size_t>(last - first);
+
+        if (count > 0) {
+            std::memmove(d_first, first, count * sizeof(T));
+        }
+        d_first += count;
+    } else {
+        while (first != last) {
+            *d_first++ = std::move(*first++);
+        }
     }
 
     return d_first;
 }
 
-/// The reallocation is done by allocating a new memory block of size new_size
-/// bytes, copying memory area with size equal to the lesser of the new and the
-/// old sizes, and freeing the old block.
+/// Moves the elements in the range, defined by (first, last), onto the live
+/// elements ending at d_last, back to front, so the destination may overlap
+/// the source as long as d_last is not before last. Trivially copyable types
+/// are shifted with a single memmove.
+///
+/// @param first  A pointer to the first element of the source sequence.
+/// @param last   A pointer to one past the last element of source sequence.
+/// @param d_last A pointer to one past the last element of the destination.
+/// @return       A pointer to the first element moved into the destination.
+template <class T>
+static
+typename Vector<T>::pointer mymovebackward(typename Vector<T>::pointer first,
+                       typename Vector<T>::pointer last,
+                       typename Vector<T>::pointer d_last) {
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        const auto count = static_cast<std::size_t>(last - first);
+
+        d_last -= count;
+        if (count > 0) {
+            std::memmove(d_last, first, count * sizeof(T));
+        }
+    } else {
+        while (first != last) {
+            *--d_last = std::move(*--last);
+        }
+    }
+
+    return d_last;
+}
+
+/// Finds the first position at which the ranges beginning at first1 and
+/// first2 differ. Trivially comparable types are skipped over a block at a
+/// time with memcmp, which the C library vectorizes, and only the block that
+/// differs is searched element by element.
 ///
+/// @param first1 A pointer to the first element of the first sequence.
+/// @param first2 A pointer to the first element of the second sequence.
+/// @param count  The number of elements in each sequence.
+/// @return       The index of the first mismatching element, or count.
+template <class T>
+static
+std::size_t mymismatch(typename Vector<T>::const_pointer first1,
+                       typename Vector<T>::const_pointer first2,
+                       std::size_t count) {
+    std::size_t i = 0;
+
+    if constexpr (is_trivially_comparable<T>::value) {
+        // elements per block of 256 bytes
+        constexpr std::size_t block = sizeof(T) < 256 ? 256 / sizeof(T) : 1;
+
+        while (i + block <= count &&
+               std::memcmp(first1 + i, first2 + i, block * sizeof(T)) == 0) {
+            i += block;
+        }
+    }
+
+    while (i < count && first1[i] == first2[i]) {
+        ++i;
+    }
+
+    return i;
+}
+
+/// The reallocation is done by allocating a new memory block of new_size
+/// elements, relocating the count live elements into it, and freeing the old
+/// block.
+///
+/// @param alloc          The allocator of the container.
 /// @param [in, out] base A reference to a pointer to the current dynamic array.
-/// @param current_size   The current size of the dynamic array.
-/// @param new size       The desired new size for the dynamic array.
+/// @param count          The number of live elements in the dynamic array.
+/// @param capacity       The current capacity of the dynamic array.
+/// @param new_size       The desired new capacity, at least count.
 /// @return               The updated pointer base.
 /// @note CS202 function operator used in lecture to remove final 6 bytes and
 ///       5 blocks of memory leakage in Vector-test2.cxx
 
-template <class T>
+template <class T, class Alloc>
 static
-typename Vector<T>::pointer resize(typename Vector<T>::pointer& base,
-                       typename Vector<T>::size_type current_size,
+typename Vector<T>::pointer resize(Alloc& alloc,
+                       typename Vector<T>::pointer& base,
+                       typename Vector<T>::size_type count,
+                       typename Vector<T>::size_type capacity,
                        typename Vector<T>::size_type new_size) {
-    if (current_size != new_size) {
-        // new array of new_size elements
-        const auto tmp   = new typename Vector<T>::value_type[new_size] {};
-        // number of elements to copy
-        const auto count = new_size < current_size ? new_size : current_size;
-
-        ::mycopy<T>(base, (base + count), tmp);
-
-        delete[] base;
-        base = tmp;
+    // new uninitialized array of new_size elements
+    const auto tmp = ::myallocate<T>(alloc, new_size);
+
+    try {
+        ::myrelocate<T>(alloc, base, (base + count), tmp);
+    } catch (...) {
+        ::mydeallocate<T>(alloc, tmp, new_size);
+        throw;
     }
 
+    ::mydeallocate<T>(alloc, base, capacity);
+    base = tmp;
+
     return base;
 }
 
 
 /* Constructors and Destructor */
 
+/// Constructs an empty container. No storage is allocated until the first
+/// element is inserted.
+template <class T, class Alloc, class Growth>
+Vector<T, Alloc, Growth>::Vector() noexcept
+    : m_alloc(), m_data(nullptr), m_capacity(0), m_count(0) {}
+
+/// Constructs an empty container that allocates from alloc.
+/// @param alloc The allocator to use for all memory of this container.
+template <class T, class Alloc, class Growth>
+Vector<T, Alloc, Growth>::Vector(const allocator_type& alloc) noexcept
+    : m_alloc(alloc), m_data(nullptr), m_capacity(0), m_count(0) {}
+
 /// Constructs the container with count copies of elements with value value.
-/// @param count The number of elements to be constructed in the vector
-/// (default zero).
+/// @param count The number of elements to be constructed in the vector.
 /// @param value The value to initialize each element with (default value).
+/// @param alloc The allocator to use for all memory of this container.
 /// @note CS202 function operator used in lecture to remove final 6 bytes and
 ///       5 blocks of memory leakage in Vector-test2.cxx
-template <class T>
-Vector<T>::Vector(size_type count, const value_type& value) {
+template <class T, class Alloc, class Growth>
+Vector<T, Alloc, Growth>::Vector(size_type count, const value_type& value,
+                                 const allocator_type& alloc)
+    : m_alloc(alloc) {
     // assign values
-    m_data      = new value_type[count];
+    m_data      = ::myallocate<T>(m_alloc, count);
     m_capacity  = count;
     m_count     = count;
-
-    // fill array with value
-    for (pointer current = begin(); current != end(); ++current) {
-        *current = value;
+    VECTOR_STATS_RECORD(on_allocate(count));
+    VECTOR_STATS_RECORD(on_copy<T>(count));
+
+    // construct each element as a copy of value
+    pointer current = m_data;
+    try {
+        for (; current != m_data + count; ++current) {
+            alloc_traits::construct(m_alloc, current, value);
+        }
+    } catch (...) {
+        // the destructor will not run: undo what was built, then pass it on
+        ::mydestroy<T>(m_alloc, m_data, current);
+        ::mydeallocate<T>(m_alloc, m_data, count);
+        throw;
     }
 }
 
@@ -306,15 +918,24 @@ Vector<T>::Vector(size_type count, const value_type& value) {
 /// @param other Another Vector object to copy from.
 /// @note CS202 function operator used in lecture to remove final 6 bytes and
 ///       5 blocks of memory leakage in Vector-test2.cxx
-template <class T>
-Vector<T>::Vector(const Vector<T>& other) {
+template <class T, class Alloc, class Growth>
+Vector<T, Alloc, Growth>::Vector(const Vector& other)
+    : m_alloc(alloc_traits::select_on_container_copy_construction(
+              other.m_alloc)) {
     // assign values based on other
-    m_data      = new value_type[other.capacity()];
-    m_capacity  = other.capacity();
+    m_data      = ::myallocate<T>(m_alloc, other.size());
+    m_capacity  = other.size();
     m_count     = other.size();
-
-    // fill array with value
-    ::mycopy<T>(other.begin(), other.end(), begin());
+    VECTOR_STATS_RECORD(on_allocate(other.size()));
+    VECTOR_STATS_RECORD(on_copy<T>(other.size()));
+
+    // fill array with value; the destructor will not run if a copy throws
+    try {
+        ::mycopy<T>(m_alloc, other.begin(), other.end(), begin());
+    } catch (...) {
+        ::mydeallocate<T>(m_alloc, m_data, m_capacity);
+        throw;
+    }
 }
 
 /// Move constructor for the Vector class. Efficiently transfers
@@ -323,8 +944,9 @@ Vector<T>::Vector(const Vector<T>& other) {
 /// @param other The Vector to be moved.
 /// @note CS202 function operator used in lecture to remove final 6 bytes and
 ///       5 blocks of memory leakage in Vector-test2.cxx
-template <class T>
-Vector<T>::Vector(Vector<T>&& other) {
+template <class T, class Alloc, class Growth>
+Vector<T, Alloc, Growth>::Vector(Vector&& other) noexcept
+    : m_alloc(std::move(other.m_alloc)) {
     // take ownership of other's properties
     m_data      = other.m_data;
     m_capacity  = other.capacity();
@@ -337,10 +959,12 @@ Vector<T>::Vector(Vector<T>&& other) {
 }
 
 /// Destructs the vector. The used storage is deallocated.
-template <class T>
-Vector<T>::~Vector() {
-    // delete data
-    delete[] m_data;
+template <class T, class Alloc, class Growth>
+Vector<T, Alloc, Growth>::~Vector() {
+    // destroy the elements and delete data
+    ::mydestroy<T>(m_alloc, m_data, m_data + m_count);
+    VECTOR_STATS_RECORD(on_deallocate(m_capacity));
+    ::mydeallocate<T>(m_alloc, m_data, m_capacity);
 
     // assign values to 0
     m_data      = nullptr;
@@ -355,23 +979,70 @@ Vector<T>::~Vector() {
 /// @return A reference to the updated Vector.
 /// @note CS202 function operator used in lecture to remove final 6 bytes and
 ///       5 blocks of memory leakage in Vector-test2.cxx
-template <class T>
-Vector<T>& Vector<T>::operator=(const Vector<T>& other) {
+template <class T, class Alloc, class Growth>
+Vector<T, Alloc, Growth>&
+Vector<T, Alloc, Growth>::operator=(const Vector& other) {
     // check for self assignment
     if (this != &other) {
-        // verify size
-        if (size() != other.size()) {
-            // delete and assign values based on other
-            delete[] m_data;
-            m_data      = new value_type[other.size()];
+        // adopt other's allocator if it propagates; memory obtained from the
+        // old allocator must be returned to it first
+        if constexpr (
+            alloc_traits::propagate_on_container_copy_assignment::value) {
+            if (!alloc_traits::is_always_equal::value &&
+                m_alloc != other.m_alloc) {
+                clear();
+                VECTOR_STATS_RECORD(on_deallocate(m_capacity));
+                ::mydeallocate<T>(m_alloc, m_data, m_capacity);
+                m_data     = nullptr;
+                m_capacity = 0;
+            }
+            m_alloc = other.m_alloc;
+        }
+
+        // reuse the current storage whenever other fits into it
+        if (other.size() > capacity()) {
+            // copy into new storage first, so that a throw leaves this
+            // vector as it was
+            const pointer new_data = ::myallocate<T>(m_alloc, other.size());
+            try {
+                ::mycopy<T>(m_alloc, other.begin(), other.end(), new_data);
+            } catch (...) {
+                ::mydeallocate<T>(m_alloc, new_data, other.size());
+                throw;
+            }
+            VECTOR_STATS_RECORD(on_allocate(other.size()));
+            VECTOR_STATS_RECORD(on_copy<T>(other.m_count));
+
+            // destroy and delete the old data, then take the copy
+            clear();
+            VECTOR_STATS_RECORD(on_deallocate(m_capacity));
+            ::mydeallocate<T>(m_alloc, m_data, m_capacity);
+            m_data      = new_data;
             m_capacity  = other.size();
+            m_count     = other.m_count;
+
+            return *this;
+        }
+
+        // number of live elements that can simply be assigned over
+        const size_type common = size() < other.size() ? size() : other.size();
+
+        // assign over the live elements
+        for (size_type i = 0; i < common; ++i) {
+            *(m_data + i) = *(other.m_data + i);
         }
 
-        // fill array with values
-        ::mycopy<T>(other.begin(), other.end(), begin());
+        // construct the remaining elements (undone if one throws), or
+        // destroy the surplus ones
+        ::mycopy<T>(m_alloc, other.m_data + common,
+                    other.m_data + other.m_count, m_data + common);
+        if (m_count > other.m_count) {
+            ::mydestroy<T>(m_alloc, m_data + other.m_count, m_data + m_count);
+        }
 
         // set m_count
         m_count = other.m_count;
+        VECTOR_STATS_RECORD(on_copy<T>(other.m_count));
 
     }
 
@@ -385,11 +1056,39 @@ Vector<T>& Vector<T>::operator=(const Vector<T>& other) {
 /// @return A reference to the updated Vector.
 /// @note CS202 function operator used in lecture to remove final 6 bytes and
 ///       5 blocks of memory leakage in Vector-test2.cxx
-template <class T>
-Vector<T>& Vector<T>::operator=(Vector<T>&& other) {
+template <class T, class Alloc, class Growth>
+Vector<T, Alloc, Growth>&
+Vector<T, Alloc, Growth>::operator=(Vector&& other) noexcept(
+    alloc_traits::propagate_on_container_move_assignment::value ||
+    alloc_traits::is_always_equal::value) {
     // check for self-assignment
     if (this != &other) {
-        delete[] m_data;
+        // storage of a foreign allocator cannot be stolen: move element-wise
+        if constexpr (
+            !alloc_traits::propagate_on_container_move_assignment::value &&
+            !alloc_traits::is_always_equal::value) {
+            if (m_alloc != other.m_alloc) {
+                clear();
+                reserve(other.size());
+                for (pointer it = other.begin(); it != other.end(); ++it) {
+                    alloc_traits::construct(m_alloc, m_data + m_count,
+                                            std::move(*it));
+                    ++m_count;
+                }
+                VECTOR_STATS_RECORD(on_move<T>(m_count));
+                other.clear();
+                return *this;
+            }
+        }
+
+        clear();
+        VECTOR_STATS_RECORD(on_deallocate(m_capacity));
+        ::mydeallocate<T>(m_alloc, m_data, m_capacity);
+
+        if constexpr (
+            alloc_traits::propagate_on_container_move_assignment::value) {
+            m_alloc = std::move(other.m_alloc);
+        }
 
         // take ownership of other's properties
         m_data      = other.m_data;
@@ -413,19 +1112,20 @@ Vector<T>& Vector<T>::operator=(Vector<T>&& other) {
 /// @return A reference to the updated Vector.
 /// @note CS202 function operator used in lecture to remove final 6 bytes and
 ///       5 blocks of memory leakage in Vector-test2.cxx
-template <class T>
-Vector<T>& Vector<T>::operator+=(const Vector<T>& other) {
+template <class T, class Alloc, class Growth>
+Vector<T, Alloc, Growth>&
+Vector<T, Alloc, Growth>::operator+=(const Vector& other) {
     // compute the minimum required capacity
     const size_type min_reqd = size() + other.size();
 
     // check if reallocation necessary
     if (min_reqd > capacity()) {
-        m_capacity = min_reqd;
-        m_data     = ::resize<T>(m_data, size(), capacity());
+        grow(min_reqd);
     }
 
     // append the elements from the other Vector to the end of this Vector
-    ::mycopy<T>(other.begin(), other.end(), end());
+    ::mycopy<T>(m_alloc, other.begin(), other.end(), end());
+    VECTOR_STATS_RECORD(on_copy<T>(other.size()));
 
     m_count = min_reqd;
 
@@ -441,16 +1141,18 @@ Vector<T>& Vector<T>::operator+=(const Vector<T>& other) {
 /// @assert pos is within the range of the container.
 /// @param pos The position of the element to access.
 /// @return Reference to the element at the specified position.
-template <class T>
-typename Vector<T>::reference Vector<T>::at(size_type pos) {
+template <class T, class Alloc, class Growth>
+typename Vector<T, Alloc, Growth>::reference
+Vector<T, Alloc, Growth>::at(size_type pos) {
     // TODO(David Tom): reference data from the specified position.
     assert((pos < size()));
 
     return *(m_data + (pos));
 }
 
-template <class T>
-typename Vector<T>::const_reference Vector<T>::at(size_type pos) const {
+template <class T, class Alloc, class Growth>
+typename Vector<T, Alloc, Growth>::const_reference
+Vector<T, Alloc, Growth>::at(size_type pos) const {
     // TODO(David Tom): reference data from the specified position.
     assert((pos < size()));
 
@@ -460,8 +1162,8 @@ typename Vector<T>::const_reference Vector<T>::at(size_type pos) const {
 /// Returns a reference to the first element in the container.
 /// @note Calling front on an empty container causes undefined behavior.
 /// @return Reference to the first element.
-template <class T>
-typename Vector<T>::reference Vector<T>::front() {
+template <class T, class Alloc, class Growth>
+typename Vector<T, Alloc, Growth>::reference Vector<T, Alloc, Growth>::front() {
     // TODO(David Tom): reference data from the first index.
     // assert(!empty());
 
@@ -479,8 +1181,9 @@ typename Vector<T>::reference Vector<T>::front() {
     return *frontValue;
 }
 
-template <class T>
-typename Vector<T>::const_reference Vector<T>::front() const {
+template <class T, class Alloc, class Growth>
+typename Vector<T, Alloc, Growth>::const_reference
+Vector<T, Alloc, Growth>::front() const {
     // TODO(David Tom): reference data from the first index.
     // assert(!empty());
 
@@ -501,8 +1204,8 @@ typename Vector<T>::const_reference Vector<T>::front() const {
 /// Returns a reference to the last element in the container.
 /// @note Calling back on an empty container causes undefined behavior.
 /// @return Reference to the last element.
-template <class T>
-typename Vector<T>::reference Vector<T>::back() {
+template <class T, class Alloc, class Growth>
+typename Vector<T, Alloc, Growth>::reference Vector<T, Alloc, Growth>::back() {
     // TODO(David Tom): reference data from the final index.
     // assert(!empty());
 
@@ -519,8 +1222,9 @@ typename Vector<T>::reference Vector<T>::back() {
     return *backValue;
 }
 
-template <class T>
-typename Vector<T>::const_reference Vector<T>::back() const {
+template <class T, class Alloc, class Growth>
+typename Vector<T, Alloc, Growth>::const_reference
+Vector<T, Alloc, Growth>::back() const {
     // TODO(David Tom): reference data from the final index.
     // assert(!empty());
 
@@ -540,8 +1244,8 @@ typename Vector<T>::const_reference Vector<T>::back() const {
 /// Returns a pointer to the first element of the vector.
 /// If the vector is empty, the returned pointer will be equal to end().
 /// @return Pointer to the first element.
-template <class T>
-typename Vector<T>::pointer Vector<T>::begin() {
+template <class T, class Alloc, class Growth>
+typename Vector<T, Alloc, Growth>::pointer Vector<T, Alloc, Growth>::begin() {
     // assert(!empty());
 
     // clean slate
@@ -557,8 +1261,9 @@ typename Vector<T>::pointer Vector<T>::begin() {
     return backValue;
 }
 
-template <class T>
-typename Vector<T>::const_pointer Vector<T>::begin() const {
+template <class T, class Alloc, class Growth>
+typename Vector<T, Alloc, Growth>::const_pointer
+Vector<T, Alloc, Growth>::begin() const {
     // assert(!empty());
 
     // clean slate
@@ -577,8 +1282,8 @@ typename Vector<T>::const_pointer Vector<T>::begin() const {
 /// Returns an pointer to the element following the last element of
 /// the vector.
 /// @return Pointer to one past the last element.
-template <class T>
-typename Vector<T>::pointer Vector<T>::end() {
+template <class T, class Alloc, class Growth>
+typename Vector<T, Alloc, Growth>::pointer Vector<T, Alloc, Growth>::end() {
     // assert(!empty());
 
     // clean slate
@@ -594,8 +1299,9 @@ typename Vector<T>::pointer Vector<T>::end() {
     return backValue;
 }
 
-template <class T>
-typename Vector<T>::const_pointer Vector<T>::end() const {
+template <class T, class Alloc, class Growth>
+typename Vector<T, Alloc, Growth>::const_pointer
+Vector<T, Alloc, Growth>::end() const {
     // assert(!empty());
 
     // clean slate
@@ -616,62 +1322,178 @@ typename Vector<T>::const_pointer Vector<T>::end() const {
 /// @param pos   The position where the elements should be inserted.
 /// @param value The value to be inserted.
 /// @return      A pointer to the inserted elements.
-template <class T>
-typename Vector<T>::pointer Vector<T>::insert(typename
-                                    Vector<T>::const_pointer pos,
-                                    const typename Vector::value_type& value) {
-    // TODO(David Tom): insert elements into new array, cleanup as needed
-    // copy array to new array, append to given location, add value if i = pos,
-    // add old array values to new array, copy new array to old array, cleanup
-
+template <class T, class Alloc, class Growth>
+typename Vector<T, Alloc, Growth>::pointer
+Vector<T, Alloc, Growth>::insert(const_pointer pos, const value_type& value) {
     pointer new_data;            // set a pointer to a new array
     size_type posIndex;          // tracks the position of the index
     posIndex = static_cast<size_type>(pos - m_data);   // index position
+    size_type new_capacity;      // tracks the capacity of the new array
+
+    if (m_count < m_capacity) {
+        // room to spare: shift the tail up by one within the current array
+        if (posIndex == m_count) {
+            alloc_traits::construct(m_alloc, m_data + m_count, value);
+        } else {
+            // copy first, value may refer to an element being shifted
+            value_type copy = value;
+
+            // move the final element into the uninitialized slot at the end
+            alloc_traits::construct(m_alloc, m_data + m_count,
+                                    std::move(*(m_data + (m_count - 1))));
+
+            // shift the remaining tail, then assign the value at pos
+            ::mymovebackward<T>(m_data + posIndex, m_data + (m_count - 1),
+                                m_data + m_count);
+            *(m_data + posIndex) = std::move(copy);
+            VECTOR_STATS_RECORD(on_move<T>(m_count - posIndex));
+        }
+        VECTOR_STATS_RECORD(on_copy<T>(1));
+    } else {
+        // the vector is full, grow the capacity by the growth policy
+        new_capacity = Growth::next(m_capacity, m_count + 1);
+
+        // assign uninitialized memory for the temporary pointer
+        new_data = ::myallocate<T>(m_alloc, new_capacity);
+
+        try {
+            // construct the value first, it may refer to an element of this
+            // vector
+            alloc_traits::construct(m_alloc, new_data + posIndex, value);
+
+            // relocate the data before and after the position around it
+            try {
+                ::myrelocatearound<T>(m_alloc, m_data, m_data + posIndex,
+                                      m_data + m_count, new_data,
+                                      new_data + posIndex + 1);
+            } catch (...) {
+                alloc_traits::destroy(m_alloc, new_data + posIndex);
+                throw;
+            }
+        } catch (...) {
+            // nothing changed: drop the new array and pass the error on
+            ::mydeallocate<T>(m_alloc, new_data, new_capacity);
+            throw;
+        }
+        VECTOR_STATS_RECORD(on_allocate(new_capacity));
+        VECTOR_STATS_RECORD(on_reallocate(m_capacity, new_capacity));
+        VECTOR_STATS_RECORD(on_copy<T>(1));
+        VECTOR_STATS_RECORD(on_relocate<T>(m_count));
 
-    // clean slate
-    new_data = nullptr;
+        // delete old data
+        VECTOR_STATS_RECORD(on_deallocate(m_capacity));
+        ::mydeallocate<T>(m_alloc, m_data, m_capacity);
 
-    // check if capacity is 0 and add 1
-    if (m_capacity == 0) {
-        m_capacity += 1;
+        // update data pointer
+        m_data     = new_data;
+        m_capacity = new_capacity;
     }
 
-    // check if size is equal to or near capacity
-    if ((m_count) >= (m_capacity)) {
-        // double size of capacity
-        m_capacity *= 2;
-    }
+    // Increment
+    m_count += 1;
 
-    // assign memory for the temporary pointer
-    new_data = new value_type[m_capacity];
+    return (m_data + posIndex);
+}
 
-    if (!empty()) {
-        // copy initial data
-        for (size_type i = 0; i < (posIndex); ++i) {
-            // copy data
-            *(new_data + i) = *(m_data + i);
-        }
+/// Inserts the elements in the range (first, last) before pos. The storage
+/// grows at most once for the whole range; if the range fits into the spare
+/// capacity the tail is shifted in place instead.
+///
+/// @param pos   The position where the elements should be inserted.
+/// @param first A forward iterator to the first element to insert.
+/// @param last  A forward iterator to one past the last element to insert.
+///              The range must not refer to elements of this Vector.
+/// @return      A pointer to the first inserted element, or pos if the range
+///              is empty.
+template <class T, class Alloc, class Growth>
+template <class ForwardIt, class>
+typename Vector<T, Alloc, Growth>::pointer
+Vector<T, Alloc, Growth>::insert(const_pointer pos, ForwardIt first,
+                                 ForwardIt last) {
+    // index position and number of elements inserted
+    const size_type posIndex = static_cast<size_type>(pos - m_data);
+    const size_type count    = static_cast<size_type>(std::distance(first,
+                                                                    last));
+
+    if (count == 0) {
+        // nothing to insert
+    } else if (m_count + count <= m_capacity) {
+        // room to spare: open a gap of count elements within the array
+        const pointer   position = m_data + posIndex;
+        const pointer   old_end  = m_data + m_count;
+        const size_type after    = m_count - posIndex;  // elements after pos
+
+        if (after > count) {
+            // move the final count elements into the uninitialized end
+            for (pointer src = old_end - count, dst = old_end; src != old_end;
+                 ++src, ++dst) {
+                alloc_traits::construct(m_alloc, dst, std::move(*src));
+            }
 
-        // if at position append value
-        *(new_data + posIndex) = value;
+            // shift the rest of the tail and assign the range into the gap
+            ::mymovebackward<T>(position, old_end - count, old_end);
+            for (pointer dst = position; first != last; ++first, ++dst) {
+                *dst = *first;
+            }
+            VECTOR_STATS_RECORD(on_move<T>(after));
+        } else {
+            // the range reaches past the old end: construct its last part
+            ForwardIt mid = first;
+            std::advance(mid, after);
+
+            pointer dst = old_end;
+            for (ForwardIt it = mid; it != last; ++it, ++dst) {
+                alloc_traits::construct(m_alloc, dst, *it);
+            }
 
-        // finish copying data at pos + 1
-        for (size_type i = ((posIndex)); i < (m_count); ++i) {
-            *(new_data + (i + 1)) = *(m_data + (i));
+            // move the whole tail behind it, then assign the first part
+            for (pointer src = position; src != old_end; ++src, ++dst) {
+                alloc_traits::construct(m_alloc, dst, std::move(*src));
+            }
+            for (dst = position; first != mid; ++first, ++dst) {
+                *dst = *first;
+            }
+            VECTOR_STATS_RECORD(on_move<T>(after));
         }
+        VECTOR_STATS_RECORD(on_copy<T>(count));
 
+        m_count += count;
     } else {
-        *(new_data) = value;
-    }
+        // grow once for the whole range
+        const size_type new_capacity = Growth::next(m_capacity,
+                                                    m_count + count);
+        const pointer   new_data     = ::myallocate<T>(m_alloc, new_capacity);
+
+        // construct the inserted elements at their final position
+        pointer dst = new_data + posIndex;
+        try {
+            for (; first != last; ++first, ++dst) {
+                alloc_traits::construct(m_alloc, dst, *first);
+            }
 
-    // delete old data
-    delete[] m_data;
+            // relocate the data before and after the position around them
+            ::myrelocatearound<T>(m_alloc, m_data, m_data + posIndex,
+                                  m_data + m_count, new_data, dst);
+        } catch (...) {
+            // nothing changed: drop the new array and pass the error on
+            ::mydestroy<T>(m_alloc, new_data + posIndex, dst);
+            ::mydeallocate<T>(m_alloc, new_data, new_capacity);
+            throw;
+        }
+        VECTOR_STATS_RECORD(on_allocate(new_capacity));
+        VECTOR_STATS_RECORD(on_reallocate(m_capacity, new_capacity));
+        VECTOR_STATS_RECORD(on_copy<T>(count));
+        VECTOR_STATS_RECORD(on_relocate<T>(m_count));
 
-    // update data pointer
-    m_data = new_data;
+        // delete old data
+        VECTOR_STATS_RECORD(on_deallocate(m_capacity));
+        ::mydeallocate<T>(m_alloc, m_data, m_capacity);
 
-    // Increment
-    m_count += 1;
+        // update data pointer
+        m_data     = new_data;
+        m_capacity = new_capacity;
+        m_count   += count;
+    }
 
     return (m_data + posIndex);
 }
@@ -680,60 +1502,55 @@ typename Vector<T>::pointer Vector<T>::insert(typename
 ///
 /// @param pos The position of the element to be erased.
 /// @return    A pointer to the elements following the erased element.
-template <class T>
-typename Vector<T>::pointer Vector<T>::erase(typename Vector<T>::pointer pos) {
-    // TODO(David Tom): erase elements from old array, cleanup as needed
-    // copy array to new array, delete at given location, delete value i = pos,
-    // add old array values to new array, copy new array to old array, cleanup
-
-    pointer new_data;            // set a pointer to a new array
+template <class T, class Alloc, class Growth>
+typename Vector<T, Alloc, Growth>::pointer
+Vector<T, Alloc, Growth>::erase(pointer pos) {
     size_type posIndex;          // tracks index for arrays
     posIndex = static_cast<size_type>(pos - m_data);   // index position
 
-    // check if array is empty
-    if (m_capacity != 0) {
-        // clean slate
-        new_data = nullptr;
-
-        // check if size is equal to or near capacity
-        if ((m_count + 1) >= (m_capacity)) {
-            // double size of capacity
-            m_capacity *= 2;
-        }
-
-        // assign memory for the temporary pointer
-        new_data = new value_type[m_capacity];
-
-        // copy data until position of desired value
-        for (size_type i = 0; i < posIndex; ++i) {
-            *(new_data + i) = *(m_data + (i));
-        }
-
-        // copy remaining data from (i + 1) to (i)
-        for (size_type i = (posIndex); i < ((m_count) - 1); ++i) {
-            *(new_data + i) = *(m_data + (i + 1));
-        }
+    // shift the remaining data from (i + 1) to (i) in place
+    if (posIndex < m_count) {
+        erase(pos, pos + 1);
+    }
 
-        // delete old data
-        delete[] m_data;
+    return (m_data + posIndex);
 
-        // append count value
-        m_count -= 1;
+}
 
-        // update data pointer
-        m_data = new_data;
+/// Erases the elements in the range (first, last). The elements following
+/// the range are shifted down in place (a single memmove for trivially
+/// copyable types) and the capacity is unchanged.
+///
+/// @param first A pointer to the first element to erase.
+/// @param last  A pointer to one past the last element to erase.
+/// @return      A pointer to the element following the erased range.
+template <class T, class Alloc, class Growth>
+typename Vector<T, Alloc, Growth>::pointer
+Vector<T, Alloc, Growth>::erase(pointer first, pointer last) {
+    // number of elements removed
+    const size_type count = static_cast<size_type>(last - first);
+
+    if (count > 0) {
+        // shift the tail down over the erased range
+        const pointer new_end = ::mymove<T>(last, m_data + m_count, first);
+
+        // destroy the moved-from elements left at the end
+        ::mydestroy<T>(m_alloc, new_end, m_data + m_count);
+        VECTOR_STATS_RECORD(on_move<T>(static_cast<size_type>(
+            (m_data + m_count) - last)));
+
+        m_count -= count;
     }
 
-    return (m_data + posIndex);
-
+    return first;
 }
 
 /* Capacity */
 
 /// Checks if the container has no elements, i.e. whether begin() == end().
 /// @return True if the container is empty, otherwise false.
-template <class T>
-bool Vector<T>::empty() const {
+template <class T, class Alloc, class Growth>
+bool Vector<T, Alloc, Growth>::empty() const {
     // TODO(David Tom): verify if class is empty
 
     return m_count == 0;
@@ -741,8 +1558,9 @@ bool Vector<T>::empty() const {
 
 /// Returns the number of elements in the container, i.e. value of m_count.
 /// @return The number of elements in the container.
-template <class T>
-typename Vector<T>::size_type Vector<T>::size() const {
+template <class T, class Alloc, class Growth>
+typename Vector<T, Alloc, Growth>::size_type
+Vector<T, Alloc, Growth>::size() const {
 
     return (m_count);
 }
@@ -750,25 +1568,70 @@ typename Vector<T>::size_type Vector<T>::size() const {
 /// Returns the number of elements that the container has currently
 /// allocated space for, i.e., value of m_capacity.
 /// @return The current capacity of the container.
-template <class T>
-typename Vector<T>::size_type Vector<T>::capacity() const {
+template <class T, class Alloc, class Growth>
+typename Vector<T, Alloc, Growth>::size_type
+Vector<T, Alloc, Growth>::capacity() const {
 
     return m_capacity;
 }
 
+/// Increases the capacity of the vector to a value that is greater than or
+/// equal to new_cap. If new_cap is not greater than capacity(), nothing is
+/// done. Otherwise all pointers and references to the elements are
+/// invalidated.
+/// @param new_cap The new capacity of the vector, in number of elements.
+template <class T, class Alloc, class Growth>
+void Vector<T, Alloc, Growth>::reserve(size_type new_cap) {
+    // only ever grow the storage
+    if (new_cap > m_capacity) {
+        VECTOR_STATS_RECORD(on_allocate(new_cap));
+        VECTOR_STATS_RECORD(on_reallocate(m_capacity, new_cap));
+        VECTOR_STATS_RECORD(on_relocate<T>(m_count));
+        VECTOR_STATS_RECORD(on_deallocate(m_capacity));
+        m_data     = ::resize<T>(m_alloc, m_data, m_count, m_capacity, new_cap);
+        m_capacity = new_cap;
+    }
+}
+
+/// Requests the removal of unused capacity, i.e., reduces capacity() to
+/// size(). If a reallocation occurs, all pointers and references to the
+/// elements are invalidated.
+template <class T, class Alloc, class Growth>
+void Vector<T, Alloc, Growth>::shrink_to_fit() {
+    if (m_count == 0) {
+        // nothing to keep, release the storage entirely
+        VECTOR_STATS_RECORD(on_deallocate(m_capacity));
+        ::mydeallocate<T>(m_alloc, m_data, m_capacity);
+        m_data = nullptr;
+    } else if (m_count < m_capacity) {
+        // relocates the m_count live elements into an exactly sized array
+        VECTOR_STATS_RECORD(on_allocate(m_count));
+        VECTOR_STATS_RECORD(on_reallocate(m_capacity, m_count));
+        VECTOR_STATS_RECORD(on_relocate<T>(m_count));
+        VECTOR_STATS_RECORD(on_deallocate(m_capacity));
+        m_data = ::resize<T>(m_alloc, m_data, m_count, m_capacity, m_count);
+    }
+
+    m_capacity = m_count;
+}
+
+/// Grows the storage by the Growth policy so that at least min_reqd
+/// elements fit without another reallocation.
+/// @param min_reqd The minimum capacity required by the caller.
+template <class T, class Alloc, class Growth>
+void Vector<T, Alloc, Growth>::grow(size_type min_reqd) {
+    reserve(Growth::next(m_capacity, min_reqd));
+}
+
 
 /* Modifiers */
 
 /// Erases all elements from the container. After this call, size()
 /// returns zero.
-template <class T>
-void Vector<T>::clear() {
-    // TODO(David Tom): create empty bag with all empty values.
-    // loop through bag's capacity and assign empty values to all indexes
-
-    for (typename Vector<T>::size_type i = 0; i < m_capacity; ++i) {
-        *(m_data + i) = 'A';
-    }
+template <class T, class Alloc, class Growth>
+void Vector<T, Alloc, Growth>::clear() {
+    // destroy the live elements, the capacity is kept for reuse
+    ::mydestroy<T>(m_alloc, m_data, m_data + m_count);
 
     m_count = 0;
 }
@@ -786,50 +1649,71 @@ void Vector<T>::clear() {
 /// to elements (e.g., begin()) may change.
 ///
 /// @param value The value to be appended to the end of the container.
-template <class T>
-void Vector<T>::push_back(const typename Vector<T>::value_type& value) {
-    // TODO(David Tom): check and, if needed, double the capacity
-    // create copy array, add values to it, delete/rebuild old array,
-    // copy data to old array with new capacity, add new data starting at end
-
-    pointer new_data;           // set a pointer to a new array
-
-    // clean slate
-    // new_data = nullptr;
+template <class T, class Alloc, class Growth>
+void Vector<T, Alloc, Growth>::push_back(const value_type& value) {
+    emplace_back(value);
+    VECTOR_STATS_RECORD(on_copy<T>(1));
+}
 
-    // check if capacity is 0
-    if (m_capacity == 0) {
-        m_capacity += 1;
-    }
+template <class T, class Alloc, class Growth>
+void Vector<T, Alloc, Growth>::push_back(value_type&& value) {
+    emplace_back(std::move(value));
+    VECTOR_STATS_RECORD(on_move<T>(1));
+}
 
-    // check if size is equal to or near capacity
-    if (m_count >= (m_capacity)) {
-        // double size of capacity
-        m_capacity *= 2;
+/// Appends a new element to the end of the container, constructed in place
+/// from args. If the new size() is greater than capacity(), a reallocation
+/// takes place and the existing elements are relocated, which only moves them
+/// when their move constructor cannot throw.
+///
+/// @param args The arguments forwarded to the constructor of the element.
+/// @return     A reference to the inserted element.
+template <class T, class Alloc, class Growth>
+template <class... Args>
+typename Vector<T, Alloc, Growth>::reference
+Vector<T, Alloc, Growth>::emplace_back(Args&&... args) {
+    // reallocate only when the spare capacity is exhausted
+    if (m_count == m_capacity) {
+        const size_type new_capacity = Growth::next(m_capacity, m_count + 1);
+        const pointer   new_data     = ::myallocate<T>(m_alloc, new_capacity);
+
+        try {
+            // construct first, args may refer to an element of this vector
+            alloc_traits::construct(m_alloc, new_data + m_count,
+                                    std::forward<Args>(args)...);
+
+            // relocate the existing elements
+            try {
+                ::myrelocate<T>(m_alloc, m_data, m_data + m_count, new_data);
+            } catch (...) {
+                alloc_traits::destroy(m_alloc, new_data + m_count);
+                throw;
+            }
+        } catch (...) {
+            // nothing changed: drop the new array and pass the error on
+            ::mydeallocate<T>(m_alloc, new_data, new_capacity);
+            throw;
         }
 
-    // Create a new array with the updated capacity
-    new_data = new value_type[m_capacity];
+        // delete the old data
+        VECTOR_STATS_RECORD(on_allocate(new_capacity));
+        VECTOR_STATS_RECORD(on_reallocate(m_capacity, new_capacity));
+        VECTOR_STATS_RECORD(on_relocate<T>(m_count));
+        VECTOR_STATS_RECORD(on_deallocate(m_capacity));
+        ::mydeallocate<T>(m_alloc, m_data, m_capacity);
 
-    // Copy the existing elements to the new array
-    for (size_type i = 0; i < m_count; ++i) {
-        *(new_data + i) = *(m_data + i);
+        m_data     = new_data;
+        m_capacity = new_capacity;
+    } else {
+        // construct the new value at the end of the array
+        alloc_traits::construct(m_alloc, m_data + m_count,
+                                std::forward<Args>(args)...);
     }
 
-    // add the new value to the end of the array
-    *(new_data + m_count) = value;
-
-    // Delete the old data
-    delete[] m_data;
-
-    // Update the data pointer to point to the new array
-    m_data = new_data;
-// }
-
-    // Add the new value to the end of the array and increment
-    // *(m_data + m_count) = value;
+    // increment
     m_count += 1;
 
+    return *(m_data + (m_count - 1));
 }
 
 /// Removes the last element of the container. Calling pop_back on an empty
@@ -840,46 +1724,71 @@ void Vector<T>::push_back(const typename Vector<T>::value_type& value) {
 /// not empty before this operation, the size of the container (size()) is
 /// reduced by one. The capacity of the vector remains unchanged, and the
 /// memory allocated for the removed element is not freed.
-template <class T>
-void Vector<T>::pop_back() {
-
-    pointer new_data;           // set a pointer to a new array
-
-    // clean slate
-    new_data = nullptr;
-
-    // check if capacity is 0
-    if (m_capacity == 0) {
-        m_capacity += 1;
-    }
-    // check if count is at or near capacity
-    if (m_count >= m_capacity) {
-        // double size of capacity
-        m_capacity *= 2;
-    }
-
+template <class T, class Alloc, class Growth>
+void Vector<T, Alloc, Growth>::pop_back() {
     if (!empty()) {
-        // Create a new array with the updated capacity
-        new_data = new typename Vector<T>::value_type[m_capacity];
+        // reduce m_count by 1 and destroy the final element in place
+        m_count -= 1;
+        ::mydestroy<T>(m_alloc, m_data + m_count, m_data + (m_count + 1));
+    }
+}
 
-        // Copy the existing elements to the new array
-        for (size_type i = 0; i < (m_count); ++i) {
-            *(new_data + i) = *(m_data + i);
+/// Resizes the container to contain count elements. If the current size is
+/// greater than count, the container is reduced to its first count
+/// elements. If the current size is less than count, additional
+/// value-initialized elements (or copies of value) are appended.
+///
+/// @param count The new size of the container.
+template <class T, class Alloc, class Growth>
+void Vector<T, Alloc, Growth>::resize(size_type count) {
+    if (count < m_count) {
+        // destroy the surplus elements, the capacity is kept
+        ::mydestroy<T>(m_alloc, m_data + count, m_data + m_count);
+        m_count = count;
+    } else if (count > m_count) {
+        if (count > m_capacity) {
+            grow(count);
         }
 
-        // assign a null value to final index
-        *(new_data + m_count) = 'A';
-
-        // Delete the old data
-        delete[] m_data;
-
-        // Update the data pointer to point to the new array
-        m_data = new_data;
+        // value-initialize the new elements
+        for (; m_count < count; ++m_count) {
+            alloc_traits::construct(m_alloc, m_data + m_count);
+        }
+    }
+}
 
-        // reduce m_count by 1
-        m_count -= 1;
+/// @param count The new size of the container.
+/// @param value The value to initialize the new elements with.
+template <class T, class Alloc, class Growth>
+void
+Vector<T, Alloc, Growth>::resize(size_type count, const value_type& value) {
+    if (count < m_count) {
+        // destroy the surplus elements, the capacity is kept
+        ::mydestroy<T>(m_alloc, m_data + count, m_data + m_count);
+        m_count = count;
+    } else if (count > m_count) {
+        if (count > m_capacity) {
+            // copy first, value may refer to an element of this vector
+            const value_type copy = value;
+
+            grow(count);
+            resize(count, copy);
+        } else {
+            // copy construct the new elements
+            VECTOR_STATS_RECORD(on_copy<T>(count - m_count));
+            for (; m_count < count; ++m_count) {
+                alloc_traits::construct(m_alloc, m_data + m_count, value);
+            }
+        }
     }
+}
 
+/// Returns the allocator associated with the container.
+/// @return A copy of the allocator.
+template <class T, class Alloc, class Growth>
+typename Vector<T, Alloc, Growth>::allocator_type
+Vector<T, Alloc, Growth>::get_allocator() const {
+    return m_alloc;
 }
 
 
@@ -896,29 +1805,29 @@ void Vector<T>::pop_back() {
 /// @param lhs The left-hand side Vector object for comparison.
 /// @param rhs The right-hand side Vector object for comparison.
 /// @return True if the vectors are equal, otherwise false.
-template <class T>
-bool equal(const Vector<T>& lhs, const Vector<T>& rhs) {
-    // TODO(David Tom): compare Vectors' contents in 'lhs' and 'rhs'.
-    bool boolState = true;                       // tracks boolState status
-
+/// @note Vectors of different sizes are rejected without looking at the
+///       elements, and trivially comparable elements are compared with a
+///       single memcmp.
+template <class T, class Alloc, class Growth>
+bool equal(const Vector<T, Alloc, Growth>& lhs,
+           const Vector<T, Alloc, Growth>& rhs) {
     // tracks size for verification
-    typename Vector<T>::size_type const totalSize = lhs.size();
-
-    // verifies size is equal
-    if (totalSize == rhs.size()) {
-        // loop through bags and compare index values
-        for (typename Vector<T>::size_type i = 0; i < totalSize; ++i) {
-            // compare index values at given position
-            if (lhs.at(i) != rhs.at(i)) {
-                boolState = false;       // assigns boolState if instance occurs
-            }
-        }
-    } else {
-        // if size is not equal set bool to false
-        boolState = false;
+    typename Vector<T, Alloc, Growth>::size_type const totalSize = lhs.size();
+
+    // vectors of different sizes are never equal
+    if (totalSize != rhs.size()) {
+        return false;
     }
 
-    return boolState;
+    // compare the whole buffers at once when the bytes decide equality
+    if constexpr (is_trivially_comparable<T>::value) {
+        return totalSize == 0 ||
+               std::memcmp(lhs.begin(), rhs.begin(),
+                           totalSize * sizeof(T)) == 0;
+    } else {
+        return ::mymismatch<T>(lhs.begin(), rhs.begin(), totalSize) ==
+               totalSize;
+    }
 }
 
 /// Equality operator for Vector objects. Compares two Vectors for equality.
@@ -927,30 +1836,37 @@ bool equal(const Vector<T>& lhs, const Vector<T>& rhs) {
 /// @param rhs The right-hand side Vector object for comparison.
 /// @return True if the vectors are equal (contain the same elements in the
 /// same order), otherwise false.
-template <class T>
-bool operator==(const Vector<T>& lhs, const Vector<T>& rhs) {
-    // TODO(David Tom): compare Vectors' contents in 'lhs' and 'rhs'.
-    bool boolState = true;                       // tracks boolState status
+template <class T, class Alloc, class Growth>
+bool operator==(const Vector<T, Alloc, Growth>& lhs,
+                const Vector<T, Alloc, Growth>& rhs) {
+    return equal(lhs, rhs);
+}
 
-    // tracks size for verification
-    typename Vector<T>::size_type const totalSize = lhs.size();
-
-    // verifies size is equal
-    if (totalSize == rhs.size()) {
-        // loop through bags and compare index values
-        for (typename Vector<T>::size_type i = 0; i < totalSize; ++i) {
-            // compare index values at given position
-            if (lhs.at(i) != rhs.at(i)) {
-                boolState = false;       // assigns boolState if instance occurs
-            }
-        }
-    } else {
-        // if size is not equal set bool to false
-        boolState = false;
+/// Compares two vector objects lexicographically: the first mismatching
+/// element decides, and if one vector is a prefix of the other the shorter
+/// one orders first.
+/// @param lhs The left-hand side Vector object for comparison.
+/// @param rhs The right-hand side Vector object for comparison.
+/// @return A negative value if lhs orders before rhs, zero if they are
+///         equal, otherwise a positive value.
+template <class T, class Alloc, class Growth>
+int compare(const Vector<T, Alloc, Growth>& lhs,
+            const Vector<T, Alloc, Growth>& rhs) {
+    // only the common prefix can be compared element by element
+    const std::size_t common = lhs.size() < rhs.size() ? lhs.size()
+                                                       : rhs.size();
+    const std::size_t pos = ::mymismatch<T>(lhs.begin(), rhs.begin(), common);
+
+    if (pos < common) {
+        return lhs[pos] < rhs[pos] ? -1 : 1;
     }
 
-    return boolState;
+    // one is a prefix of the other: the shorter vector comes first
+    if (lhs.size() == rhs.size()) {
+        return 0;
+    }
 
+    return lhs.size() < rhs.size() ? -1 : 1;
 }
 
 /* EOF */
@@ -27,12 +27,21 @@
 
 // template file(s)
 #include "Vector.hpp"       // vector template
+#include "JaggedVector.hpp" // flattened table of rows
+#include "SmallVector.hpp"  // vector with inline storage
+#include "Arena.hpp"        // monotonic arena allocator
 
 // Global constant definition(s)
 const int COL1 = 18;              // used for column spacing for output
 const int COL2 = 6;               // used for column spacing for output
 const int COL3 = 4;               // used for column spacing for output
 
+// Type alias(es): all scores in one array, one row per student, taken from
+// one arena and freed together; the scores of a line are gathered in a row
+// that holds up to 16 of them inline
+using ScoreRow   = SmallVector<int, 16>;
+using ScoreTable = JaggedVector<int, ArenaAllocator<int>>;
+
 
 /// -------------------------------------------------------------------------
 /// Structure Declaration(s)
@@ -44,16 +53,16 @@ const int COL3 = 4;               // used for column spacing for output
 /// -------------------------------------------------------------------------
 // Input Phase
 void readStudentData(Vector<std::string>& student_names,
-                     Vector<Vector<int>>& student_scores);
+                     ScoreTable& student_scores);
 
 // Processing Phase
-int sum(Vector<Vector<int>>& student_scores);
-double average(Vector<Vector<int>>& student_scores);
+int sum(ScoreTable& student_scores);
+double average(ScoreTable& student_scores);
 char setGrade(double average);
 
 // Output Phase
 void printStatistics(Vector<std::string>& student_names,
-                     Vector<Vector<int>>& student_scores);
+                     ScoreTable& student_scores);
 
 /// -------------------------------------------------------------------------
 /// Main entry-point for this application
@@ -65,8 +74,9 @@ int main() {
     int exitState;                      // tracks the exit code for the process
     exitState = EXIT_SUCCESS;           // set state to successful run
 
+    MonotonicArena arena;                     // owns all score storage
     Vector<std::string> student_names;        // stores student names
-    Vector<Vector<int>> student_scores;       // stores student scores
+    ScoreTable student_scores(&arena);        // stores student scores
 
     /* ******* Input Phase ************************************************** */
     readStudentData(student_names, student_scores);
@@ -78,6 +88,11 @@ int main() {
     student_names.clear();
     student_scores.clear();
 
+#ifdef VECTOR_STATS
+    // report the memory traffic of all Vectors on the error stream
+    std::cerr << vector_global_stats();
+#endif
+
     return exitState;
 }
 
@@ -90,7 +105,7 @@ int main() {
 /// @param student_names is the names of the students
 /// @param student_scores is the score of the students
 void readStudentData(Vector<std::string>& student_names,
-                     Vector<Vector<int>>& student_scores) {
+                     ScoreTable& student_scores) {
     std::string line;       // stores line
 
     // eof loop
@@ -105,16 +120,16 @@ void readStudentData(Vector<std::string>& student_names,
         ss >> name;
         student_names.push_back(name);
 
-        // set/reset scores
+        // set/reset scores, inline for up to 16 of them
         int score;
-        Vector<int> scores;
+        ScoreRow scores;
 
         // iterate and push numbers to scores
         while (ss >> score) {
             scores.push_back(score);
         }
-        // push back scores to student_scores
-        student_scores.push_back(scores);
+        // append scores as a new row, growing the table once
+        student_scores.append_row(scores.begin(), scores.end());
     }
 }
 
@@ -122,17 +137,13 @@ void readStudentData(Vector<std::string>& student_names,
 /// Function will calculate the sum of all elements in the class.
 /// @param student_scores are the integers stored to be referenced.
 /// @return the sum of all the elements in the class.
-int sum(Vector<Vector<int>>& student_scores) {
+int sum(ScoreTable& student_scores) {
     int sum = 0;                         // stores the sum of the values
 
-    // obtain a sum from all elements in the Bag
-    for (int i = 0; i < static_cast<int>(student_scores.size()); ++i) {
-        // iterate through all contents of scores
-        for (int j = 0; j < static_cast<int>(student_scores.at(i).size());
-             ++j) {
-            // add to sum
-            sum += student_scores.at(i).at(j);
-        }
+    // obtain a sum from all scores, stored back to back across the rows
+    for (int score : student_scores.values()) {
+        // add to sum
+        sum += score;
     }
 
     return sum;
@@ -143,16 +154,10 @@ int sum(Vector<Vector<int>>& student_scores) {
 /// @param student_scores  are the integers stored to be referenced.
 /// @return the average of the elements in the class.
 /// @note average = sum of all elements / size of all elements
-double average(Vector<Vector<int>>& student_scores) {
+double average(ScoreTable& student_scores) {
     double avg = 0;                              // stores the average value
-    int totalScores = 0;                         // total number of scores
-    // total number of students
-    int totalStudents = static_cast<int>(student_scores.size());
-
-    // obtain scores for average
-    for (int i = 0; i < totalStudents; ++i) {
-        totalScores += student_scores.at(i).size();
-    }
+    // total number of scores
+    int totalScores = static_cast<int>(student_scores.value_count());
 
     // obtain average, see note in function for equation
     if (student_scores.size() > 0) {
@@ -190,7 +195,7 @@ char setGrade(double average) {
 /// Function will output the computed statistics and contents from the class.
 /// @param vector are the integers stored to be referenced.
 void printStatistics(Vector<std::string>& student_names,
-                     Vector<Vector<int>>& student_scores) {
+                     ScoreTable& student_scores) {
     // Variable Declaration(s)
     /// COL based on column widths from output
     /// COL1 + (COL2 * (number of scores + 1)) + 1
@@ -0,0 +1,396 @@
+/// @file Bench.hpp
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file contains the container microbenchmark harness shared by
+/// the Container-bench programs. It times the common operations of sequence
+/// containers (push_back, insert and erase in the middle, iteration, copy
+/// and move) and of stacks (push, top and pop, copy and move) for several
+/// element types and sizes, so that a custom container and its standard
+/// library counterpart are measured by the very same code. The results are
+/// collected in a BenchReport and written as CSV or JSON, one record per
+/// container, element type, operation and size.
+///
+/// Example usage:
+/// @code
+///   BenchReport report;
+///   benchSequence<Vector>(report, "Vector", 6);
+///   benchSequence<std::vector>(report, "std::vector", 6);
+///   report.write(std::cout, "csv");
+/// @endcode
+
+
+#ifndef BENCH_HPP
+#define BENCH_HPP
+
+// header files
+#include <chrono>
+#include <cstddef>  // provides std::size_t
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef __GLIBC__
+#include <malloc.h>  // provides mallopt
+#endif
+
+/// Number of operations timed per measurement (summed over repetitions), so
+/// that small sizes are repeated often enough to be timed reliably.
+const std::size_t BENCH_WORK = 2000000;
+
+/// Most elements inserted into or erased from the middle per repetition. The
+/// repetitions of these operations are counted like those of n push_backs,
+/// as each of them rebuilds a container of n elements first.
+const std::size_t BENCH_MIDDLE = 100;
+
+/// Record is a 64-byte trivially copyable element, standing for a row of
+/// fields copied by value.
+struct Record {
+    long long fields[8];  ///< Payload of the record
+};
+
+/// One measurement: the average cost of an operation on a container of a
+/// given size.
+struct BenchResult {
+    std::string container;  ///< Name of the container
+    std::string type;       ///< Name of the element type
+    std::string operation;  ///< Name of the operation
+    std::size_t elements;   ///< Number of elements in the container
+    double      ns;         ///< Average nanoseconds per operation
+};
+
+/// BenchReport collects the measurements of one run and writes them out.
+class BenchReport {
+public:
+    /// Adds a measurement to the report.
+    /// @param result The measurement to add.
+    void add(const BenchResult& result) { m_results.push_back(result); }
+
+    /// Writes all measurements to os.
+    /// @param os     The stream to write to.
+    /// @param format "json" for a JSON array of objects, otherwise CSV with a
+    ///               header line.
+    void write(std::ostream& os, const std::string& format) const;
+
+private:
+    std::vector<BenchResult> m_results;  ///< Measurements in run order
+};
+
+/// Writes all measurements to os.
+/// @param os     The stream to write to.
+/// @param format "json" for a JSON array of objects, otherwise CSV with a
+///               header line.
+inline void BenchReport::write(std::ostream& os,
+                               const std::string& format) const {
+    const bool json = format == "json";
+
+    os << (json ? "[\n" : "container,type,operation,elements,ns_per_op\n");
+
+    for (std::size_t i = 0; i < m_results.size(); ++i) {
+        const BenchResult& r = m_results[i];
+
+        if (json) {
+            os << "  {\"container\": \"" << r.container
+               << "\", \"type\": \"" << r.type
+               << "\", \"operation\": \"" << r.operation
+               << "\", \"elements\": " << r.elements
+               << ", \"ns_per_op\": " << r.ns << "}"
+               << (i + 1 < m_results.size() ? ",\n" : "\n");
+        } else {
+            os << r.container << ',' << r.type << ',' << r.operation << ','
+               << r.elements << ',' << r.ns << '\n';
+        }
+    }
+
+    if (json) {
+        os << "]\n";
+    }
+}
+
+/* Element Types */
+
+/// Returns the name of an element type for the report.
+/// @return The name of T.
+template <class T>
+const char* benchTypeName();
+
+template <>
+inline const char* benchTypeName<int>() { return "int"; }
+
+template <>
+inline const char* benchTypeName<std::string>() { return "string"; }
+
+template <>
+inline const char* benchTypeName<Record>() { return "record64"; }
+
+/// Returns the i-th element value used to fill the containers.
+/// @param i The index of the value.
+/// @return  The value, of type T.
+template <class T>
+T benchValue(std::size_t i);
+
+template <>
+inline int benchValue<int>(std::size_t i) {
+    return static_cast<int>(i);
+}
+
+template <>
+inline std::string benchValue<std::string>(std::size_t i) {
+    // short enough for the small string buffer, like most words
+    return "word" + std::to_string(i % 10000);
+}
+
+template <>
+inline Record benchValue<Record>(std::size_t i) {
+    Record record = {};
+    record.fields[0] = static_cast<long long>(i);
+    return record;
+}
+
+/// Returns a number read from an element, so that visiting an element
+/// really loads it.
+/// @param value The element.
+/// @return      A number derived from the element.
+inline std::size_t benchKey(int value) {
+    return static_cast<std::size_t>(value);
+}
+
+inline std::size_t benchKey(const std::string& value) {
+    return value.size();
+}
+
+inline std::size_t benchKey(const Record& value) {
+    return static_cast<std::size_t>(value.fields[0]);
+}
+
+/* Timing */
+
+/// Keeps freed memory in the heap for the rest of the run. By default glibc
+/// maps large blocks separately and trims the heap after large frees, and it
+/// adapts both thresholds as the program runs, so the first container to be
+/// measured would pay page faults that the later ones do not. Call this once
+/// before any measurement.
+inline void benchSettleHeap() {
+#ifdef __GLIBC__
+    mallopt(M_MMAP_THRESHOLD, 32 << 20);    // the largest threshold allowed
+    mallopt(M_TRIM_THRESHOLD, 64 << 20);
+#endif
+}
+
+/// Keeps the results of the timed code observable.
+inline std::size_t& benchSink() {
+    static std::size_t sink = 0;
+    return sink;
+}
+
+/// Adds a timed result to the sink: a count as is, a container by size.
+/// @param result The value returned by the timed code.
+template <class R>
+void benchConsume(const R& result) {
+    if constexpr (std::is_integral<R>::value) {
+        benchSink() += static_cast<std::size_t>(result);
+    } else {
+        benchSink() += result.size();
+    }
+}
+
+/// Times body over reps repetitions. Each repetition calls setup untimed to
+/// build a fresh state, then times body(state); the state and whatever body
+/// returns are destroyed after the clock stops. One untimed repetition runs
+/// first to warm up the caches and the heap.
+///
+/// @param ops   The number of operations body performs per repetition.
+/// @param reps  The number of repetitions.
+/// @param setup Returns the state of one repetition.
+/// @param body  The timed operations.
+/// @return      The average cost of one operation, in nanoseconds.
+template <class Setup, class Body>
+double benchMeasure(std::size_t ops, std::size_t reps, Setup setup,
+                    Body body) {
+    std::chrono::steady_clock::duration total{};
+
+    // warm up
+    {
+        auto state = setup();
+        benchConsume(body(state));
+    }
+
+    for (std::size_t r = 0; r < reps; ++r) {
+        auto state = setup();
+
+        const auto start  = std::chrono::steady_clock::now();
+        auto       result = body(state);
+        total += std::chrono::steady_clock::now() - start;
+
+        benchConsume(result);
+    }
+
+    const std::chrono::duration<double, std::nano> elapsed = total;
+    return elapsed.count() / static_cast<double>(ops * reps);
+}
+
+/// Returns the number of repetitions for ops operations per repetition.
+/// @param ops The number of operations per repetition.
+/// @return    The number of repetitions (at least one).
+inline std::size_t benchReps(std::size_t ops) {
+    return ops > 0 && BENCH_WORK / ops > 0 ? BENCH_WORK / ops : 1;
+}
+
+/* Sequence Containers */
+
+/// Measures push_back, insert and erase in the middle, iteration, copy and
+/// move of Container<T> with n elements.
+/// @param report The report to add the measurements to.
+/// @param name   The name of the container.
+/// @param n      The number of elements.
+template <template <class...> class Container, class T>
+void benchSequenceOf(BenchReport& report, const char* name, std::size_t n) {
+    using C = Container<T>;
+
+    std::vector<T> values;
+    for (std::size_t i = 0; i < n; ++i) {
+        values.push_back(benchValue<T>(i));
+    }
+
+    const auto empty  = [] { return C(); };
+    const auto filled = [&values] {
+        C c;
+        for (const T& value : values) {
+            c.push_back(value);
+        }
+        return c;
+    };
+    const auto add = [&](const char* operation, double ns) {
+        report.add(BenchResult{name, benchTypeName<T>(), operation, n, ns});
+    };
+
+    add("push_back", benchMeasure(n, benchReps(n), empty,
+                                  [&values](C& c) {
+        for (const T& value : values) {
+            c.push_back(value);
+        }
+        return c.size();
+    }));
+
+    const std::size_t inserts = n < BENCH_MIDDLE ? n : BENCH_MIDDLE;
+    add("insert_middle", benchMeasure(inserts, benchReps(n), filled,
+                                      [&values, inserts](C& c) {
+        for (std::size_t i = 0; i < inserts; ++i) {
+            c.insert(std::next(c.begin(), c.size() / 2), values[i]);
+        }
+        return c.size();
+    }));
+
+    const std::size_t erases = n / 2 < BENCH_MIDDLE ? n / 2 : BENCH_MIDDLE;
+    add("erase_middle", benchMeasure(erases, benchReps(n), filled,
+                                     [erases](C& c) {
+        for (std::size_t i = 0; i < erases; ++i) {
+            c.erase(std::next(c.begin(), c.size() / 2));
+        }
+        return c.size();
+    }));
+
+    const C source = filled();
+    add("iterate", benchMeasure(n, benchReps(n), [] { return 0; },
+                                [&source](int&) {
+        std::size_t visited = 0;
+        for (auto it = source.begin(); it != source.end(); ++it) {
+            visited += benchKey(*it);
+        }
+        return visited;
+    }));
+
+    add("copy", benchMeasure(n, benchReps(n), [] { return 0; },
+                             [&source](int&) { return C(source); }));
+
+    add("move", benchMeasure(1, benchReps(n), filled,
+                             [](C& c) { return C(std::move(c)); }));
+}
+
+/// Measures the sequence operations of Container for int, std::string and
+/// Record elements and 10^2 up to 10^maxExp elements.
+/// @param report The report to add the measurements to.
+/// @param name   The name of the container.
+/// @param maxExp The largest power of ten to measure.
+template <template <class...> class Container>
+void benchSequence(BenchReport& report, const char* name, int maxExp) {
+    std::size_t n = 100;
+    for (int exp = 2; exp <= maxExp; ++exp, n *= 10) {
+        benchSequenceOf<Container, int>(report, name, n);
+        benchSequenceOf<Container, std::string>(report, name, n);
+        benchSequenceOf<Container, Record>(report, name, n);
+    }
+}
+
+/* Stacks */
+
+/// Measures push, top and pop, copy and move of Stack<T> with n elements.
+/// @param report The report to add the measurements to.
+/// @param name   The name of the stack.
+/// @param n      The number of elements.
+template <template <class...> class Stack, class T>
+void benchStackOf(BenchReport& report, const char* name, std::size_t n) {
+    using S = Stack<T>;
+
+    std::vector<T> values;
+    for (std::size_t i = 0; i < n; ++i) {
+        values.push_back(benchValue<T>(i));
+    }
+
+    const auto empty  = [] { return S(); };
+    const auto filled = [&values] {
+        S s;
+        for (const T& value : values) {
+            s.push(value);
+        }
+        return s;
+    };
+    const auto add = [&](const char* operation, double ns) {
+        report.add(BenchResult{name, benchTypeName<T>(), operation, n, ns});
+    };
+
+    add("push", benchMeasure(n, benchReps(n), empty, [&values](S& s) {
+        for (const T& value : values) {
+            s.push(value);
+        }
+        return s.size();
+    }));
+
+    add("top_pop", benchMeasure(n, benchReps(n), filled, [](S& s) {
+        std::size_t popped = 0;
+        while (!s.empty()) {
+            popped += benchKey(s.top());
+            s.pop();
+        }
+        return popped;
+    }));
+
+    const S source = filled();
+    add("copy", benchMeasure(n, benchReps(n), [] { return 0; },
+                             [&source](int&) { return S(source); }));
+
+    add("move", benchMeasure(1, benchReps(n), filled,
+                             [](S& s) { return S(std::move(s)); }));
+}
+
+/// Measures the stack operations of Stack for int, std::string and Record
+/// elements and 10^2 up to 10^maxExp elements.
+/// @param report The report to add the measurements to.
+/// @param name   The name of the stack.
+/// @param maxExp The largest power of ten to measure.
+template <template <class...> class Stack>
+void benchStack(BenchReport& report, const char* name, int maxExp) {
+    std::size_t n = 100;
+    for (int exp = 2; exp <= maxExp; ++exp, n *= 10) {
+        benchStackOf<Stack, int>(report, name, n);
+        benchStackOf<Stack, std::string>(report, name, n);
+        benchStackOf<Stack, Record>(report, name, n);
+    }
+}
+
+#endif  // BENCH_HPP
+
+// EOF: Bench.hpp
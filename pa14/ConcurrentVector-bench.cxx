@@ -0,0 +1,146 @@
+/// @file ConcurrentVector-bench.cxx
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file benchmarks parallel word ingestion as pa14 performs it
+/// serially: every thread normalizes its share of the words (trimming the
+/// punctuation and lowering the case) and appends the results to one shared
+/// container. The words are appended to a ConcurrentVector without any lock
+/// and to a Vector guarded by a std::mutex, for 1 up to the number of
+/// hardware threads (doubling), and the elapsed milliseconds are reported.
+///
+/// Example usage:
+/// @code
+///   g++ -O2 -pthread ConcurrentVector-bench.cxx -o concurrent-bench
+///   ./concurrent-bench 1000000 8  # 10^6 words (default 10^7), 1 to 8 threads
+/// @endcode
+
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "Vector.hpp"
+#include "ConcurrentVector.hpp"
+
+/// Returns the word without its leading and trailing punctuation, in lower
+/// case, as pa14's processWord does.
+/// @param word The word read from the input.
+/// @return     The normalized word.
+std::string normalize(const std::string& word) {
+    std::size_t start = 0;
+    std::size_t end   = word.size();
+
+    const auto alnum = [&word](std::size_t i) {
+        return std::isalnum(static_cast<unsigned char>(word[i])) != 0;
+    };
+
+    while (start < end && !alnum(start)) {
+        ++start;
+    }
+    while (end > start && !alnum(end - 1)) {
+        --end;
+    }
+
+    std::string result;
+    for (std::size_t i = start; i < end; ++i) {
+        result += static_cast<char>(
+            std::tolower(static_cast<unsigned char>(word[i])));
+    }
+
+    return result;
+}
+
+/// Runs append on threads threads, thread t receiving the words with an index
+/// congruent to t, and returns the elapsed milliseconds.
+/// @param words   The input words.
+/// @param threads The number of threads.
+/// @param append  Called with every normalized word.
+/// @return        The elapsed time, in milliseconds.
+template <class Append>
+double runMs(const Vector<std::string>& words, unsigned threads,
+             Append append) {
+    const auto start = std::chrono::steady_clock::now();
+
+    Vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&words, threads, t, &append] {
+            for (std::size_t i = t; i < words.size(); i += threads) {
+                append(normalize(words[i]));
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    const std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+/// -------------------------------------------------------------------------
+/// Main entry-point for this application
+///
+/// @returns Exit-code for the process - 0 for success, else an error code.
+/// -------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    // number of words to ingest (default 10^7)
+    const std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10)
+                                       : 10000000;
+    // most threads to run (default the number of hardware threads)
+    const unsigned hardware   = std::thread::hardware_concurrency();
+    const unsigned maxThreads = argc > 2 ? std::atoi(argv[2])
+                                         : (hardware > 0 ? hardware : 1);
+
+    // a vocabulary of words with capitals and punctuation, as in pa14 input
+    const char* vocabulary[] = {"The", "quick,", "(brown)", "fox", "jumps!",
+                                "Over", "the", "lazy", "\"dog\"", "again."};
+    Vector<std::string> words;
+    words.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        words.push_back(vocabulary[i % 10]);
+    }
+
+    std::cout << count << " words" << std::endl
+              << std::left
+              << std::setw(10) << "threads"
+              << std::setw(16) << "Concurrent"
+              << std::setw(16) << "Vector+mutex"
+              << "(ms)" << std::endl;
+
+    for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+        ConcurrentVector<std::string> concurrent;
+        const double lockFree = runMs(words, threads,
+                                      [&concurrent](std::string&& word) {
+            concurrent.push_back(std::move(word));
+        });
+
+        Vector<std::string> locked;
+        std::mutex          lock;
+        const double guarded = runMs(words, threads,
+                                     [&locked, &lock](std::string&& word) {
+            std::lock_guard<std::mutex> hold(lock);
+            locked.push_back(std::move(word));
+        });
+
+        // both containers must hold every word
+        if (concurrent.size() != count || locked.size() != count) {
+            std::cerr << "lost words" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        std::cout << std::left << std::fixed << std::setprecision(1)
+                  << std::setw(10) << threads
+                  << std::setw(16) << lockFree
+                  << std::setw(16) << guarded << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+// EOF: ConcurrentVector-bench.cxx
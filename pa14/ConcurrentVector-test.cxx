@@ -0,0 +1,196 @@
+/// @file ConcurrentVector-test.cxx
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file contains Catch2 unit tests for the ConcurrentVector
+/// class: appending across segment boundaries, the holes left by elements
+/// whose constructor throws, and several threads appending while another
+/// scans the published elements. Build with -pthread.
+
+#include <atomic>
+#include <cstddef>  // provides std::size_t
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+
+#include "ConcurrentVector.hpp"
+
+/// Checked holds a value and its complement, so a reader can tell a fully
+/// constructed element from a torn one. Its constructor throws for every
+/// value that is 3 modulo 7, and the live count tracks the objects.
+struct Checked {
+    static std::atomic<int> live;  ///< Objects constructed and not destroyed
+
+    long value;
+    long complement;
+
+    explicit Checked(long v) : value(v), complement(~v) {
+        if (v % 7 == 3) {
+            throw std::runtime_error("construction failed");
+        }
+        ++live;
+    }
+    Checked(const Checked& other)
+        : value(other.value), complement(other.complement) {
+        ++live;
+    }
+    ~Checked() { --live; }
+
+    /// Returns true if the element holds a value and its complement.
+    bool whole() const { return complement == ~value; }
+};
+
+std::atomic<int> Checked::live{0};
+
+/// Appends value to vector, returning false if its constructor threw.
+static bool tryAppend(ConcurrentVector<Checked>& vector, long value) {
+    try {
+        vector.emplace_back(value);
+        return true;
+    } catch (const std::runtime_error&) {
+        return false;
+    }
+}
+
+TEST_CASE("ConcurrentVector appends across segments", "[ConcurrentVector]") {
+    ConcurrentVector<long> vector;
+    CHECK(vector.empty());
+    CHECK_FALSE(vector.published(0));
+    CHECK_THROWS_AS(vector.at(0), std::out_of_range);
+
+    const std::size_t count = 10 * ConcurrentVector<long>::SEGMENT + 5;
+    for (std::size_t i = 0; i < count; ++i) {
+        CHECK(vector.push_back(static_cast<long>(i) * 3) == i);
+    }
+
+    REQUIRE(vector.size() == count);
+    for (std::size_t i = 0; i < count; ++i) {
+        REQUIRE(vector.published(i));
+        REQUIRE(vector[i] == static_cast<long>(i) * 3);
+    }
+    CHECK_FALSE(vector.published(count));
+    CHECK_THROWS_AS(vector.at(count), std::out_of_range);
+
+    // references stay valid while the vector grows
+    long& first = vector[0];
+    for (std::size_t i = 0; i < count; ++i) {
+        vector.push_back(-1);
+    }
+    CHECK(&first == &vector[0]);
+
+    vector.clear();
+    CHECK(vector.empty());
+    CHECK(vector.push_back(7) == 0);
+    CHECK(vector.at(0) == 7);
+}
+
+TEST_CASE("ConcurrentVector leaves a hole for a throwing element",
+          "[ConcurrentVector]") {
+    {
+        ConcurrentVector<Checked> vector;
+        long appended = 0;
+        long sum = 0;
+        for (long v = 0; v < 100; ++v) {
+            if (tryAppend(vector, v)) {
+                ++appended;
+                sum += v;
+            }
+        }
+
+        // every index is counted, the failed ones are never published
+        REQUIRE(vector.size() == 100);
+        CHECK(Checked::live == appended);
+
+        long seen = 0;
+        long seenSum = 0;
+        for (std::size_t i = 0; i < vector.size(); ++i) {
+            if (i % 7 == 3) {
+                CHECK_FALSE(vector.published(i));
+                CHECK_THROWS_AS(vector.at(i), std::out_of_range);
+            } else if (vector.published(i)) {
+                ++seen;
+                seenSum += vector.at(i).value;
+            }
+        }
+        CHECK(seen == appended);
+        CHECK(seenSum == sum);
+
+        // the holes are skipped when the elements are destroyed
+        vector.clear();
+        CHECK(Checked::live == 0);
+        tryAppend(vector, 1);
+    }
+    CHECK(Checked::live == 0);
+}
+
+TEST_CASE("ConcurrentVector takes appends from several threads",
+          "[ConcurrentVector]") {
+    const int  writers = 4;
+    const long perWriter = 5000;
+
+    ConcurrentVector<Checked> vector;
+    std::atomic<long> appended{0};
+    std::atomic<long> appendedSum{0};
+    std::atomic<bool> done{false};
+    std::atomic<long> torn{0};
+
+    // a reader scans the published elements while the writers append
+    std::thread reader([&] {
+        while (!done.load(std::memory_order_acquire)) {
+            const std::size_t size = vector.size();
+            for (std::size_t i = 0; i < size; ++i) {
+                if (vector.published(i) && !vector[i].whole()) {
+                    ++torn;
+                }
+            }
+        }
+    });
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < writers; ++t) {
+        threads.emplace_back([&, t] {
+            long count = 0;
+            long sum = 0;
+            for (long i = 0; i < perWriter; ++i) {
+                const long value = t * perWriter + i;
+                if (tryAppend(vector, value)) {
+                    ++count;
+                    sum += value;
+                }
+            }
+            appended += count;
+            appendedSum += sum;
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    CHECK(torn == 0);
+    REQUIRE(vector.size() == static_cast<std::size_t>(writers * perWriter));
+
+    // each published value appears once, and together they make the sum
+    std::vector<bool> seen(writers * perWriter, false);
+    long count = 0;
+    long sum = 0;
+    for (std::size_t i = 0; i < vector.size(); ++i) {
+        if (vector.published(i)) {
+            const Checked& element = vector.at(i);
+            REQUIRE(element.whole());
+            REQUIRE_FALSE(seen[element.value]);
+            seen[element.value] = true;
+            ++count;
+            sum += element.value;
+        }
+    }
+    CHECK(count == appended);
+    CHECK(sum == appendedSum);
+    CHECK(Checked::live == appended);
+}
+
+// EOF: ConcurrentVector-test.cxx
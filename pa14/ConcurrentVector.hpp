@@ -0,0 +1,396 @@
+/// @file ConcurrentVector.hpp
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file declares ConcurrentVector, a growable array that several
+/// threads can append to at the same time. The elements live in a table of
+/// segments whose sizes double, so growing never relocates an element:
+/// references and indices stay valid for the lifetime of the container and
+/// readers never race with a reallocation.
+///
+/// Example usage:
+/// @code
+///   ConcurrentVector<std::string> words;
+///   // from any number of threads
+///   const std::size_t i = words.push_back(word);
+///   std::cout << words[i];
+/// @endcode
+
+#ifndef CONCURRENT_VECTOR_HPP
+#define CONCURRENT_VECTOR_HPP
+
+#include <atomic>
+#include <cstddef>  // provides std::size_t
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+/// ConcurrentVector is a sequence container that supports concurrent
+/// push_back. Each append claims the next index with one atomic increment,
+/// constructs the element in the segment holding that index and then
+/// publishes it; a missing segment is installed with a compare-and-swap, so
+/// no thread ever waits on a lock. Segment 0 holds the first SEGMENT elements
+/// and every further segment is as large as all previous ones together.
+///
+/// Appending and reading published elements may happen concurrently. An
+/// element is published once the push_back that created it has returned;
+/// the index returned by push_back may be handed to other threads, which can
+/// test it with published(). clear() and destruction require that no other
+/// thread uses the container.
+///
+/// An index is counted by size() as soon as it is claimed, before its element
+/// is constructed. If the constructor or the allocation of a segment throws,
+/// the index stays claimed but is never published, leaving a hole below
+/// size(). To scan the elements, test each index with published() or read it
+/// with at(); operator[] is only for indices known to be published, such as
+/// those returned by push_back.
+///
+/// @tparam T Type of the elements.
+template <class T>
+class ConcurrentVector {
+public:
+    // Public aliases
+    using size_type       = std::size_t;
+    using value_type      = T;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+
+    /// Number of elements in the first segment, a power of two.
+    static const size_type SEGMENT = 32;
+
+    /* Constructors and Destructor */
+
+    /// Constructs an empty container. No storage is allocated until the first
+    /// element is appended.
+    ConcurrentVector() noexcept;
+
+    ConcurrentVector(const ConcurrentVector&) = delete;
+    ConcurrentVector& operator=(const ConcurrentVector&) = delete;
+
+    /// Destructs the container. The elements are destroyed and all segments
+    /// are deallocated.
+    ~ConcurrentVector();
+
+    /* Element Access */
+
+    /// Returns a reference to the element at specified location pos, with
+    /// bounds checking.
+    /// @param pos The position of the element to access.
+    /// @return    Reference to the element at the specified position.
+    /// @throws std::out_of_range if pos is not a published element.
+    reference at(size_type pos);
+    const_reference at(size_type pos) const;
+
+    /// Returns a reference to the element at specified location pos. No
+    /// bounds checking is performed: an index below size() may be a hole.
+    /// @pre pos is a published element.
+    /// @param pos The position of the element to access.
+    /// @return    Reference to the element at the specified position.
+    reference operator[](size_type pos) { return *slot(pos); }
+    const_reference operator[](size_type pos) const { return *slot(pos); }
+
+    /* Capacity */
+
+    /// Checks whether the element at pos has been constructed and is visible
+    /// to the calling thread.
+    /// @param pos The position of the element.
+    /// @return    True if the element may be read.
+    bool published(size_type pos) const noexcept;
+
+    /// Checks if the container has no elements.
+    /// @return True if no element was appended.
+    bool empty() const noexcept;
+
+    /// Returns the number of indices claimed so far, including those of
+    /// elements other threads are still constructing and those whose
+    /// construction threw, which are never published.
+    /// @return The number of indices handed out by push_back.
+    size_type size() const noexcept;
+
+    /* Modifiers */
+
+    /// Appends a copy of value to the end of the container. Safe to call
+    /// from several threads at once; no element is ever relocated.
+    /// @param value The value of the element to append.
+    /// @return      The index of the new element.
+    size_type push_back(const value_type& value);
+    size_type push_back(value_type&& value);
+
+    /// Appends a new element constructed in place from args. Safe to call
+    /// from several threads at once; no element is ever relocated. If the
+    /// constructor throws, the claimed index is left as an unpublished hole.
+    /// @param args The arguments forwarded to the constructor of the element.
+    /// @return     The index of the new element.
+    template <class... Args>
+    size_type emplace_back(Args&&... args);
+
+    /// Erases all elements and deallocates the segments. Not thread-safe.
+    void clear() noexcept;
+
+private:
+    /// Storage for one element and the flag that publishes it.
+    struct Slot {
+        alignas(T) unsigned char storage[sizeof(T)];  ///< Raw element
+        std::atomic<bool> ready{false};  ///< Set once storage holds a T
+    };
+
+    /// One segment per bit of the index above the first segment.
+    static const size_type SEGMENTS = sizeof(size_type) * 8;
+
+    /// Returns the segment holding the element at pos.
+    /// @param pos The position of the element.
+    /// @return    The number of the segment.
+    static size_type segmentOf(size_type pos) noexcept;
+
+    /// Returns the position of the first element of a segment.
+    /// @param segment The number of the segment.
+    /// @return        The position of its first element.
+    static size_type segmentBase(size_type segment) noexcept;
+
+    /// Returns the number of elements in a segment.
+    /// @param segment The number of the segment.
+    /// @return        Its size, in elements.
+    static size_type segmentSize(size_type segment) noexcept;
+
+    /// Returns the slot of the element at pos, installing its segment first
+    /// if no thread did so yet.
+    /// @param pos The position of the element.
+    /// @return    A pointer to the slot.
+    Slot* claim(size_type pos);
+
+    /// Returns the element at pos. The segment must exist.
+    /// @param pos The position of the element.
+    /// @return    A pointer to the element.
+    T* slot(size_type pos) const noexcept;
+
+    std::atomic<Slot*>     m_segments[SEGMENTS];  ///< Segment table
+    std::atomic<size_type> m_count;               ///< Indices handed out
+};
+
+// ----------------------------------------------------------------------------
+
+/* Constructors and Destructor */
+
+/// Constructs an empty container. No storage is allocated until the first
+/// element is appended.
+template <class T>
+ConcurrentVector<T>::ConcurrentVector() noexcept : m_count(0) {
+    for (std::atomic<Slot*>& segment : m_segments) {
+        segment.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+/// Destructs the container. The elements are destroyed and all segments
+/// are deallocated.
+template <class T>
+ConcurrentVector<T>::~ConcurrentVector() {
+    clear();
+}
+
+/* Element Access */
+
+/// Returns a reference to the element at specified location pos, with
+/// bounds checking.
+/// @param pos The position of the element to access.
+/// @return    Reference to the element at the specified position.
+/// @throws std::out_of_range if pos is not a published element.
+template <class T>
+typename ConcurrentVector<T>::reference
+ConcurrentVector<T>::at(size_type pos) {
+    // throw exception
+    if (!published(pos)) {
+        throw std::out_of_range("Out of Range!");
+    }
+
+    return *slot(pos);
+}
+
+template <class T>
+typename ConcurrentVector<T>::const_reference
+ConcurrentVector<T>::at(size_type pos) const {
+    // throw exception
+    if (!published(pos)) {
+        throw std::out_of_range("Out of Range!");
+    }
+
+    return *slot(pos);
+}
+
+/* Capacity */
+
+/// Checks whether the element at pos has been constructed and is visible
+/// to the calling thread.
+/// @param pos The position of the element.
+/// @return    True if the element may be read.
+template <class T>
+bool ConcurrentVector<T>::published(size_type pos) const noexcept {
+    if (pos >= size()) {
+        return false;
+    }
+
+    const size_type segment = segmentOf(pos);
+    const Slot* slots = m_segments[segment].load(std::memory_order_acquire);
+
+    // the acquire pairs with the release in emplace_back
+    return slots != nullptr &&
+           slots[pos - segmentBase(segment)].ready.load(
+               std::memory_order_acquire);
+}
+
+/// Checks if the container has no elements.
+/// @return True if no element was appended.
+template <class T>
+bool ConcurrentVector<T>::empty() const noexcept {
+    return size() == 0;
+}
+
+/// Returns the number of indices claimed so far, including those of
+/// elements other threads are still constructing and those whose
+/// construction threw, which are never published.
+/// @return The number of indices handed out by push_back.
+template <class T>
+typename ConcurrentVector<T>::size_type
+ConcurrentVector<T>::size() const noexcept {
+    return m_count.load(std::memory_order_acquire);
+}
+
+/* Modifiers */
+
+/// Appends a copy of value to the end of the container. Safe to call
+/// from several threads at once; no element is ever relocated.
+/// @param value The value of the element to append.
+/// @return      The index of the new element.
+template <class T>
+typename ConcurrentVector<T>::size_type
+ConcurrentVector<T>::push_back(const value_type& value) {
+    return emplace_back(value);
+}
+
+template <class T>
+typename ConcurrentVector<T>::size_type
+ConcurrentVector<T>::push_back(value_type&& value) {
+    return emplace_back(std::move(value));
+}
+
+/// Appends a new element constructed in place from args. Safe to call
+/// from several threads at once; no element is ever relocated. If the
+/// constructor or claim() throws, the index cannot be given back, as later
+/// ones may already be handed out: its slot keeps ready unset, which
+/// published(), at() and clear() all treat as a hole.
+/// @param args The arguments forwarded to the constructor of the element.
+/// @return     The index of the new element.
+template <class T>
+template <class... Args>
+typename ConcurrentVector<T>::size_type
+ConcurrentVector<T>::emplace_back(Args&&... args) {
+    // claim an index, no other thread will ever write to it
+    const size_type pos = m_count.fetch_add(1, std::memory_order_acq_rel);
+    Slot* const     target = claim(pos);
+
+    // construct, then publish the element to the readers; nothing is
+    // published if the constructor throws
+    ::new (static_cast<void*>(target->storage))
+        T(std::forward<Args>(args)...);
+    target->ready.store(true, std::memory_order_release);
+
+    return pos;
+}
+
+/// Erases all elements and deallocates the segments. Not thread-safe.
+template <class T>
+void ConcurrentVector<T>::clear() noexcept {
+    for (size_type segment = 0; segment < SEGMENTS; ++segment) {
+        Slot* slots = m_segments[segment].load(std::memory_order_relaxed);
+
+        if (slots != nullptr) {
+            // destroy the published elements, then the segment itself
+            for (size_type i = 0; i < segmentSize(segment); ++i) {
+                if (slots[i].ready.load(std::memory_order_relaxed)) {
+                    std::launder(reinterpret_cast<T*>(slots[i].storage))->~T();
+                }
+            }
+
+            delete[] slots;
+            m_segments[segment].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    m_count.store(0, std::memory_order_release);
+}
+
+/* Segment Table */
+
+/// Returns the segment holding the element at pos.
+/// @param pos The position of the element.
+/// @return    The number of the segment.
+template <class T>
+typename ConcurrentVector<T>::size_type
+ConcurrentVector<T>::segmentOf(size_type pos) noexcept {
+    // the segment is the bit width of the index in units of SEGMENT
+    size_type segment = 0;
+    for (size_type blocks = pos / SEGMENT; blocks != 0; blocks >>= 1) {
+        ++segment;
+    }
+
+    return segment;
+}
+
+/// Returns the position of the first element of a segment.
+/// @param segment The number of the segment.
+/// @return        The position of its first element.
+template <class T>
+typename ConcurrentVector<T>::size_type
+ConcurrentVector<T>::segmentBase(size_type segment) noexcept {
+    return segment == 0 ? 0 : SEGMENT << (segment - 1);
+}
+
+/// Returns the number of elements in a segment.
+/// @param segment The number of the segment.
+/// @return        Its size, in elements.
+template <class T>
+typename ConcurrentVector<T>::size_type
+ConcurrentVector<T>::segmentSize(size_type segment) noexcept {
+    return segment == 0 ? SEGMENT : SEGMENT << (segment - 1);
+}
+
+/// Returns the slot of the element at pos, installing its segment first
+/// if no thread did so yet.
+/// @param pos The position of the element.
+/// @return    A pointer to the slot.
+template <class T>
+typename ConcurrentVector<T>::Slot*
+ConcurrentVector<T>::claim(size_type pos) {
+    const size_type segment = segmentOf(pos);
+    Slot* slots = m_segments[segment].load(std::memory_order_acquire);
+
+    if (slots == nullptr) {
+        // race to install the segment, the losers free their copy
+        Slot* fresh = new Slot[segmentSize(segment)];
+
+        if (m_segments[segment].compare_exchange_strong(
+                slots, fresh, std::memory_order_acq_rel,
+                std::memory_order_acquire)) {
+            slots = fresh;
+        } else {
+            delete[] fresh;
+        }
+    }
+
+    return slots + (pos - segmentBase(segment));
+}
+
+/// Returns the element at pos. The segment must exist.
+/// @param pos The position of the element.
+/// @return    A pointer to the element.
+template <class T>
+T* ConcurrentVector<T>::slot(size_type pos) const noexcept {
+    const size_type segment = segmentOf(pos);
+    Slot* slots = m_segments[segment].load(std::memory_order_acquire);
+
+    return std::launder(reinterpret_cast<T*>(
+        slots[pos - segmentBase(segment)].storage));
+}
+
+#endif  // CONCURRENT_VECTOR_HPP
+
+// EOF: ConcurrentVector.hpp
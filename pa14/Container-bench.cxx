@@ -0,0 +1,47 @@
+/// @file Container-bench.cxx
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file benchmarks the Vector template against std::vector with
+/// the shared harness in Bench.hpp: push_back, insert and erase in the
+/// middle, iteration, copy and move, for int, std::string and 64-byte record
+/// elements and 10^2 up to 10^max elements (default 10^5). The results are
+/// written to the standard output as CSV (default) or JSON, so that the
+/// output of two revisions can be compared.
+///
+/// Example usage:
+/// @code
+///   g++ -O2 Container-bench.cxx -o container-bench
+///   ./container-bench json 6 > container-bench.json
+/// @endcode
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Vector.hpp"
+#include "Bench.hpp"
+
+/// -------------------------------------------------------------------------
+/// Main entry-point for this application
+///
+/// @returns Exit-code for the process - 0 for success, else an error code.
+/// -------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    // output format (csv or json) and largest power of ten (default 10^5)
+    const std::string format = argc > 1 ? argv[1] : "csv";
+    const int maxExp = argc > 2 ? std::atoi(argv[2]) : 5;
+
+    benchSettleHeap();
+
+    BenchReport report;
+    benchSequence<Vector>(report, "Vector", maxExp);
+    benchSequence<std::vector>(report, "std::vector", maxExp);
+
+    report.write(std::cout, format);
+
+    return EXIT_SUCCESS;
+}
+
+// EOF: Container-bench.cxx
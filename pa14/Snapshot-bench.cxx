@@ -0,0 +1,122 @@
+/// @file Snapshot-bench.cxx
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file benchmarks a warm restart from a binary snapshot against
+/// re-parsing the text input. A Vector<int> of n counts is written as text,
+/// one number per line, and as a snapshot; the report lists the time to
+/// parse the text back, to load the snapshot with one bulk read, and to map
+/// it as a SnapshotView with and without checksum verification.
+///
+/// Example usage:
+/// @code
+///   g++ -O2 Snapshot-bench.cxx -o snapshot-bench
+///   ./snapshot-bench 1000000    # 10^6 counts (default 10^7)
+/// @endcode
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include "Vector.hpp"
+#include "Snapshot.hpp"
+
+/// Returns the milliseconds elapsed since start.
+/// @param start The time point to measure from.
+/// @return      The elapsed time, in milliseconds.
+double elapsedMs(std::chrono::steady_clock::time_point start) {
+    const std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+/// Prints one line of the report.
+/// @param name The name of the restart method.
+/// @param ms   The time it took, in milliseconds.
+void printTiming(const char* name, double ms) {
+    std::cout << std::left << std::fixed << std::setprecision(2)
+              << std::setw(20) << name << ms << std::endl;
+}
+
+/// -------------------------------------------------------------------------
+/// Main entry-point for this application
+///
+/// @returns Exit-code for the process - 0 for success, else an error code.
+/// -------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    // number of counts (default 10^7)
+    const std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10)
+                                       : 10000000;
+    const char* text     = "snapshot-bench.txt";
+    const char* snapshot = "snapshot-bench.snap";
+
+    Vector<int> counts;
+    counts.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        counts.push_back(static_cast<int>((i * 2654435761U) % 100000));
+    }
+
+    // the cold input and the snapshot of the aggregated result
+    {
+        std::ofstream out(text);
+        for (int value : counts) {
+            out << value << '\n';
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    save_snapshot(counts, snapshot);
+    const double saved = elapsedMs(start);
+
+    // cold restart: parse the text again
+    start = std::chrono::steady_clock::now();
+    Vector<int> parsed;
+    {
+        std::ifstream in(text);
+        int value;
+        while (in >> value) {
+            parsed.push_back(value);
+        }
+    }
+    const double parsing = elapsedMs(start);
+
+    // warm restarts
+    start = std::chrono::steady_clock::now();
+    Vector<int> loaded;
+    load_snapshot(snapshot, loaded);
+    const double loading = elapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    const SnapshotView<int> verified(snapshot);
+    const double viewing = elapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    const SnapshotView<int> mapped(snapshot, false);
+    const double mapping = elapsedMs(start);
+
+    // all restarts must see the same counts
+    if (!(parsed == counts) || !(loaded == counts) ||
+        verified.size() != count || mapped.size() != count ||
+        (count > 0 && mapped[count - 1] != counts[count - 1])) {
+        std::cerr << "snapshot mismatch" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << count << " counts" << std::endl;
+    printTiming("save", saved);
+    printTiming("parse text", parsing);
+    printTiming("load", loading);
+    printTiming("view (verified)", viewing);
+    printTiming("view", mapping);
+    std::cout << "(ms)" << std::endl;
+
+    std::remove(text);
+    std::remove(snapshot);
+
+    return EXIT_SUCCESS;
+}
+
+// EOF: Snapshot-bench.cxx
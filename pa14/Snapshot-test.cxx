@@ -0,0 +1,205 @@
+/// @file Snapshot-test.cxx
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file contains Catch2 unit tests for Vector snapshots: saving
+/// and loading them back, and rejecting, through both load_snapshot() and
+/// SnapshotView, a file that is truncated, tagged with another element type
+/// or whose payload no longer matches its checksum. The tests write their
+/// snapshots to the current directory and remove them.
+
+#include <algorithm>
+#include <cstddef>  // provides std::size_t, offsetof
+#include <cstdint>
+#include <cstdio>   // provides std::remove
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+
+#include "Snapshot.hpp"
+#include "Snapshot.hpp"  // test include guard
+
+/// Point is a struct of two ints, the same size as a long long.
+struct Point {
+    int x;
+    int y;
+};
+
+/// Path of the snapshot written by the tests.
+static const std::string PATH = "snapshot-test.snap";
+
+/// Returns the bytes of the file at path.
+static std::string readFile(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in),
+                       std::istreambuf_iterator<char>());
+}
+
+/// Replaces the file at path by bytes.
+static void writeFile(const std::string& path, const std::string& bytes) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+/// Returns a Vector of count ints, i * i - 7.
+static Vector<int> numbers(std::size_t count) {
+    Vector<int> result;
+    for (std::size_t i = 0; i < count; ++i) {
+        result.push_back(static_cast<int>(i * i) - 7);
+    }
+    return result;
+}
+
+/// Checks that loading the snapshot at PATH as T, both into a Vector and
+/// through a SnapshotView, throws a runtime_error naming PATH and problem.
+/// A load rejected by its header leaves the Vector as it was; one rejected
+/// by its checksum leaves it empty.
+template <class T>
+static void checkRejected(const std::string& problem) {
+    const std::string expected = PATH + ": " + problem;
+
+    Vector<T> vector(3);
+    CHECK_THROWS_WITH(load_snapshot(PATH, vector), expected);
+    CHECK_THROWS_AS(load_snapshot(PATH, vector), std::runtime_error);
+    CHECK(vector.size() == (problem == "checksum mismatch" ? 0 : 3));
+
+    CHECK_THROWS_WITH(SnapshotView<T>(PATH), expected);
+    CHECK_THROWS_AS(SnapshotView<T>(PATH), std::runtime_error);
+}
+
+// Test a snapshot that loads
+TEST_CASE("Snapshot saves and loads a Vector", "[Snapshot]") {
+    SECTION("load_snapshot() and SnapshotView read the elements back") {
+        const Vector<int> saved = numbers(1000);
+        save_snapshot(saved, PATH);
+        CHECK(readFile(PATH).size() == sizeof(SnapshotHeader) + 4000);
+
+        Vector<int> loaded = numbers(5);
+        load_snapshot(PATH, loaded);
+        REQUIRE(loaded.size() == saved.size());
+        CHECK(std::equal(loaded.begin(), loaded.end(), saved.begin()));
+
+        SnapshotView<int> view(PATH);
+        REQUIRE(view.size() == saved.size());
+        CHECK(std::equal(view.begin(), view.end(), saved.begin()));
+        CHECK(view.at(999) == saved[999]);
+        CHECK_THROWS_AS(view.at(1000), std::out_of_range);
+
+        SnapshotView<int> moved(std::move(view));
+        CHECK(view.empty());
+        CHECK(moved[10] == saved[10]);
+    }
+
+    SECTION("an empty Vector") {
+        save_snapshot(Vector<int>(), PATH);
+        Vector<int> loaded = numbers(5);
+        load_snapshot(PATH, loaded);
+        CHECK(loaded.empty());
+        CHECK(SnapshotView<int>(PATH).empty());
+    }
+
+    SECTION("a missing file") {
+        std::remove(PATH.c_str());
+        Vector<int> loaded;
+        CHECK_THROWS_AS(load_snapshot(PATH, loaded), std::system_error);
+        CHECK_THROWS_AS(SnapshotView<int>(PATH), std::system_error);
+    }
+
+    std::remove(PATH.c_str());
+}
+
+// Test the snapshots that are rejected
+TEST_CASE("Snapshot rejects a damaged or mismatched file", "[Snapshot]") {
+    save_snapshot(numbers(100), PATH);
+    const std::string bytes = readFile(PATH);
+    REQUIRE(bytes.size() == sizeof(SnapshotHeader) + 400);
+
+    SECTION("a file cut inside the payload") {
+        writeFile(PATH, bytes.substr(0, bytes.size() - 1));
+        checkRejected<int>("truncated");
+        writeFile(PATH, bytes.substr(0, sizeof(SnapshotHeader) + 200));
+        checkRejected<int>("truncated");
+        writeFile(PATH, bytes.substr(0, sizeof(SnapshotHeader)));
+        checkRejected<int>("truncated");
+    }
+
+    SECTION("a file cut inside the header") {
+        writeFile(PATH, bytes.substr(0, sizeof(SnapshotHeader) - 1));
+        checkRejected<int>("truncated");
+        writeFile(PATH, "");
+        checkRejected<int>("truncated");
+    }
+
+    SECTION("a file with bytes after the payload") {
+        writeFile(PATH, bytes + "extra");
+        checkRejected<int>("truncated");
+    }
+
+    SECTION("a count larger than the file") {
+        std::string large = bytes;
+        const std::uint64_t count = ~std::uint64_t(0) / 2;
+        large.replace(offsetof(SnapshotHeader, count), sizeof(count),
+                      reinterpret_cast<const char*>(&count), sizeof(count));
+        writeFile(PATH, large);
+        checkRejected<int>("truncated");
+    }
+
+    SECTION("another element type of the same size") {
+        checkRejected<unsigned>("element type mismatch");
+        checkRejected<float>("element type mismatch");
+        checkRejected<long long>("element type mismatch");
+
+        save_snapshot(Vector<Point>(50), PATH);
+        checkRejected<long long>("element type mismatch");
+        checkRejected<double>("element type mismatch");
+    }
+
+    SECTION("a type tag changed in the header") {
+        std::string tagged = bytes;
+        tagged[offsetof(SnapshotHeader, type_tag) + 6] ^= 0x01;
+        writeFile(PATH, tagged);
+        checkRejected<int>("element type mismatch");
+    }
+
+    SECTION("a flipped bit in the payload") {
+        for (std::size_t at : {std::size_t(0), std::size_t(123),
+                               bytes.size() - sizeof(SnapshotHeader) - 1}) {
+            std::string flipped = bytes;
+            flipped[sizeof(SnapshotHeader) + at] ^= 0x10;
+            writeFile(PATH, flipped);
+            checkRejected<int>("checksum mismatch");
+        }
+
+        // a view that skips the check maps the damaged payload anyway
+        SnapshotView<int> unchecked(PATH, false);
+        CHECK(unchecked.size() == 100);
+    }
+
+    SECTION("a changed checksum in the header") {
+        std::string changed = bytes;
+        changed[offsetof(SnapshotHeader, checksum)] ^= 0x01;
+        writeFile(PATH, changed);
+        checkRejected<int>("checksum mismatch");
+    }
+
+    SECTION("a wrong magic or version") {
+        std::string magic = bytes;
+        magic[0] = 'X';
+        writeFile(PATH, magic);
+        checkRejected<int>("not a snapshot");
+
+        std::string version = bytes;
+        version[offsetof(SnapshotHeader, version)] ^= 0x02;
+        writeFile(PATH, version);
+        checkRejected<int>("unsupported version");
+    }
+
+    std::remove(PATH.c_str());
+}
+
+// EOF: Snapshot-test.cxx
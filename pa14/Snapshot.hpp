@@ -0,0 +1,406 @@
+/// @file Snapshot.hpp
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file saves a Vector of trivially copyable elements to a binary
+/// snapshot and loads it back, so a restarted program can skip re-parsing
+/// its text input. A snapshot is a 64-byte header (magic, format version,
+/// byte order, element type tag and size, element count and a checksum of
+/// the payload) followed by the raw elements. It can be read back into a
+/// Vector with a single bulk read, or mapped into memory and used in place
+/// through a SnapshotView.
+///
+/// Example usage:
+/// @code
+///   save_snapshot(counts, "counts.snap");
+///   Vector<int> again;
+///   load_snapshot("counts.snap", again);     // one read into the Vector
+///   SnapshotView<int> view("counts.snap");   // zero-copy, read-only
+/// @endcode
+
+
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+// header files
+#include <cerrno>
+#include <cstddef>  // provides std::size_t
+#include <cstdint>
+#include <cstdio>   // provides std::rename, std::remove
+#include <cstring>  // provides std::memcmp, std::memcpy
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+// POSIX memory mapping
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "Vector.hpp"
+
+/// SnapshotType identifies an element type in a snapshot, so that loading a
+/// snapshot as a different type is rejected. The default tag encodes the
+/// category (signed or unsigned integer, floating point, enum or other),
+/// the size and the alignment of T; specialize it with a unique value to
+/// tell apart structs of the same size.
+///
+/// @tparam T Type of the elements.
+template <class T>
+struct SnapshotType {
+    static const std::uint64_t tag =
+        (std::uint64_t(std::is_floating_point<T>::value ? 3 :
+                       std::is_enum<T>::value           ? 4 :
+                       !std::is_integral<T>::value      ? 5 :
+                       std::is_signed<T>::value         ? 1 : 2) << 48) |
+        (std::uint64_t(alignof(T)) << 32) | std::uint64_t(sizeof(T));
+};
+
+/// SnapshotHeader is the fixed-size header at the start of every snapshot.
+/// The payload starts right after it, 64 bytes into the file, which keeps a
+/// mapped payload aligned for any element type.
+struct SnapshotHeader {
+    /// Current version of the snapshot format.
+    static const std::uint32_t VERSION = 1;
+
+    /// Written in native byte order; reads back differently on a machine of
+    /// the other endianness.
+    static const std::uint32_t ENDIAN_MARK = 0x01020304;
+
+    char          magic[8];      ///< "VECSNAP" and a terminating zero
+    std::uint32_t version;       ///< Format version, VERSION
+    std::uint32_t byte_order;    ///< ENDIAN_MARK as written by the saver
+    std::uint64_t type_tag;      ///< SnapshotType<T>::tag of the elements
+    std::uint64_t element_size;  ///< sizeof(T)
+    std::uint64_t count;         ///< Number of elements in the payload
+    std::uint64_t checksum;      ///< snapshot_checksum of the payload
+    std::uint8_t  reserved[16];  ///< Zero, pads the header to 64 bytes
+};
+
+static_assert(sizeof(SnapshotHeader) == 64, "snapshot header is 64 bytes");
+
+/// Computes the checksum of a snapshot payload. The bytes are mixed as four
+/// independent 64-bit lanes of 8-byte words (the round of xxHash64), so the
+/// checksum runs at close to memory bandwidth.
+///
+/// @param data  A pointer to the first byte.
+/// @param bytes The number of bytes.
+/// @return      The 64-bit checksum.
+inline std::uint64_t snapshot_checksum(const void* data, std::size_t bytes) {
+    const std::uint64_t PRIME1 = 0x9E3779B185EBCA87ULL;
+    const std::uint64_t PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+
+    const auto round = [PRIME1, PRIME2](std::uint64_t acc,
+                                        std::uint64_t word) {
+        acc += word * PRIME2;
+        acc  = (acc << 31) | (acc >> 33);
+        return acc * PRIME1;
+    };
+
+    const unsigned char* byte = static_cast<const unsigned char*>(data);
+    std::uint64_t lane[4] = {PRIME1 + PRIME2, PRIME2, 0, 0 - PRIME1};
+    std::size_t   i       = 0;
+
+    // four words per step, one per lane
+    for (; i + 32 <= bytes; i += 32) {
+        for (int l = 0; l < 4; ++l) {
+            std::uint64_t word;
+            std::memcpy(&word, byte + i + 8 * l, sizeof(word));
+            lane[l] = round(lane[l], word);
+        }
+    }
+
+    // fold the lanes, the length and the remaining bytes together
+    std::uint64_t hash = lane[0] ^ round(lane[1], lane[2]) ^
+                         round(lane[3], static_cast<std::uint64_t>(bytes));
+    for (; i < bytes; ++i) {
+        hash = round(hash, byte[i]);
+    }
+
+    return hash;
+}
+
+/// Checks that header describes a snapshot of elements of type T.
+///
+/// @param header The header read from the snapshot.
+/// @param bytes  The size of the snapshot file.
+/// @param path   The path of the snapshot, for the error message.
+/// @throws std::runtime_error if the header does not match.
+template <class T>
+void check_snapshot(const SnapshotHeader& header, std::uint64_t bytes,
+                    const std::string& path) {
+    const char* problem = nullptr;
+
+    if (std::memcmp(header.magic, "VECSNAP", 8) != 0) {
+        problem = "not a snapshot";
+    } else if (header.byte_order != SnapshotHeader::ENDIAN_MARK) {
+        problem = "written with another byte order";
+    } else if (header.version != SnapshotHeader::VERSION) {
+        problem = "unsupported version";
+    } else if (header.type_tag != SnapshotType<T>::tag ||
+               header.element_size != sizeof(T)) {
+        problem = "element type mismatch";
+    } else if (header.count > (bytes - sizeof(header)) / sizeof(T) ||
+               sizeof(header) + header.count * sizeof(T) != bytes) {
+        problem = "truncated";
+    }
+
+    if (problem != nullptr) {
+        throw std::runtime_error(path + ": " + problem);
+    }
+}
+
+/// Writes the elements of vector to a snapshot file at path. The snapshot is
+/// written to a temporary file next to path first and then renamed, so a
+/// crash never leaves a partial snapshot behind.
+///
+/// @param vector The Vector to save.
+/// @param path   The path of the snapshot file.
+/// @throws std::system_error if the file cannot be written.
+template <class T, class Alloc, class Growth>
+void save_snapshot(const Vector<T, Alloc, Growth>& vector,
+                   const std::string& path) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "snapshots hold trivially copyable elements only");
+
+    const std::size_t bytes = vector.size() * sizeof(T);
+
+    SnapshotHeader header = {};
+    std::memcpy(header.magic, "VECSNAP", 8);
+    header.version      = SnapshotHeader::VERSION;
+    header.byte_order   = SnapshotHeader::ENDIAN_MARK;
+    header.type_tag     = SnapshotType<T>::tag;
+    header.element_size = sizeof(T);
+    header.count        = vector.size();
+    header.checksum     = snapshot_checksum(vector.begin(), bytes);
+
+    // the header and the payload, each in one write
+    const std::string partial = path + ".partial";
+    {
+        std::ofstream out(partial, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(vector.begin()),
+                  static_cast<std::streamsize>(bytes));
+        out.close();
+
+        if (!out) {
+            const int error = errno;
+            std::remove(partial.c_str());
+            throw std::system_error(error, std::generic_category(), partial);
+        }
+    }
+
+    if (std::rename(partial.c_str(), path.c_str()) != 0) {
+        const int error = errno;
+        std::remove(partial.c_str());
+        throw std::system_error(error, std::generic_category(), path);
+    }
+}
+
+/// Replaces the contents of vector by the elements of the snapshot at path.
+/// The elements are read with a single bulk read straight into the storage
+/// of the Vector and the checksum is verified.
+///
+/// @param path   The path of the snapshot file.
+/// @param vector The Vector to load into.
+/// @throws std::system_error  if the file cannot be read.
+/// @throws std::runtime_error if the file is not a valid snapshot of T.
+template <class T, class Alloc, class Growth>
+void load_snapshot(const std::string& path, Vector<T, Alloc, Growth>& vector) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "snapshots hold trivially copyable elements only");
+
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        throw std::system_error(errno, std::generic_category(), path);
+    }
+    const std::uint64_t bytes = static_cast<std::uint64_t>(in.tellg());
+
+    SnapshotHeader header;
+    in.seekg(0);
+    if (bytes < sizeof(header) ||
+        !in.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        throw std::runtime_error(path + ": truncated");
+    }
+    check_snapshot<T>(header, bytes, path);
+
+    // size the Vector once, then read the payload into it
+    vector.clear();
+    vector.resize(static_cast<std::size_t>(header.count));
+
+    const std::size_t payload = vector.size() * sizeof(T);
+    if (!in.read(reinterpret_cast<char*>(vector.begin()),
+                 static_cast<std::streamsize>(payload))) {
+        throw std::runtime_error(path + ": truncated");
+    }
+
+    if (snapshot_checksum(vector.begin(), payload) != header.checksum) {
+        vector.clear();
+        throw std::runtime_error(path + ": checksum mismatch");
+    }
+}
+
+/// SnapshotView maps a snapshot file into memory and offers read access to
+/// its elements in place, without copying them. The pages are read on first
+/// access, so opening a view of any size only costs the mapping (plus one
+/// pass over the payload if the checksum is verified).
+///
+/// @tparam T Type of the elements.
+template <class T>
+class SnapshotView {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "snapshots hold trivially copyable elements only");
+
+public:
+    // Public aliases
+    using size_type       = std::size_t;
+    using value_type      = T;
+    using const_reference = const value_type&;
+    using const_pointer   = const value_type*;
+
+    /// Maps the snapshot at path.
+    /// @param path   The path of the snapshot file.
+    /// @param verify True to verify the checksum, which reads every page.
+    /// @throws std::system_error  if the file cannot be opened or mapped.
+    /// @throws std::runtime_error if the file is not a valid snapshot of T.
+    explicit SnapshotView(const std::string& path, bool verify = true);
+
+    /// Moves the mapping of other into a new view.
+    /// @param other The view to be moved, left empty.
+    SnapshotView(SnapshotView&& other) noexcept;
+
+    SnapshotView(const SnapshotView&) = delete;
+    SnapshotView& operator=(const SnapshotView&) = delete;
+
+    /// Unmaps the snapshot. Pointers to its elements become invalid.
+    ~SnapshotView();
+
+    /// Returns a reference to the element at specified location pos, with
+    /// bounds checking.
+    /// @param pos The position of the element to access.
+    /// @return    Reference to the element at the specified position.
+    /// @throws std::out_of_range if pos >= size().
+    const_reference at(size_type pos) const;
+
+    const_reference operator[](size_type pos) const { return m_first[pos]; }
+
+    /// Returns a pointer to the first element of the snapshot.
+    /// @return Pointer to the first element.
+    const_pointer begin() const { return m_first; }
+
+    /// Returns a pointer to one past the last element of the snapshot.
+    /// @return Pointer to one past the last element.
+    const_pointer end() const { return m_first + m_count; }
+
+    /// Checks if the snapshot has no elements.
+    /// @return True if the snapshot is empty, otherwise false.
+    bool empty() const { return m_count == 0; }
+
+    /// Returns the number of elements in the snapshot.
+    /// @return The number of elements.
+    size_type size() const { return m_count; }
+
+private:
+    void*         m_map;       ///< Start of the mapping, nullptr if none
+    std::size_t   m_map_size;  ///< Length of the mapping in bytes
+    const_pointer m_first;     ///< First element, right after the header
+    size_type     m_count;     ///< Number of elements
+};
+
+// ----------------------------------------------------------------------------
+
+/// Maps the snapshot at path.
+/// @param path   The path of the snapshot file.
+/// @param verify True to verify the checksum, which reads every page.
+/// @throws std::system_error  if the file cannot be opened or mapped.
+/// @throws std::runtime_error if the file is not a valid snapshot of T.
+template <class T>
+SnapshotView<T>::SnapshotView(const std::string& path, bool verify)
+    : m_map(nullptr), m_map_size(0), m_first(nullptr), m_count(0) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::system_error(errno, std::generic_category(), path);
+    }
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        const int error = errno;
+        ::close(fd);
+        throw std::system_error(error, std::generic_category(), path);
+    }
+    m_map_size = static_cast<std::size_t>(info.st_size);
+
+    if (m_map_size < sizeof(SnapshotHeader)) {
+        ::close(fd);
+        throw std::runtime_error(path + ": truncated");
+    }
+
+    m_map = ::mmap(nullptr, m_map_size, PROT_READ, MAP_SHARED, fd, 0);
+    const int error = errno;
+    ::close(fd);                    // the mapping outlives the descriptor
+    if (m_map == MAP_FAILED) {
+        m_map = nullptr;
+        throw std::system_error(error, std::generic_category(), path);
+    }
+
+    try {
+        SnapshotHeader header;
+        std::memcpy(&header, m_map, sizeof(header));
+        check_snapshot<T>(header, m_map_size, path);
+
+        m_first = reinterpret_cast<const_pointer>(
+            static_cast<const char*>(m_map) + sizeof(header));
+        m_count = static_cast<size_type>(header.count);
+
+        if (verify && snapshot_checksum(m_first, m_count * sizeof(T)) !=
+                          header.checksum) {
+            throw std::runtime_error(path + ": checksum mismatch");
+        }
+    } catch (...) {
+        ::munmap(m_map, m_map_size);
+        throw;
+    }
+}
+
+/// Moves the mapping of other into a new view.
+/// @param other The view to be moved, left empty.
+template <class T>
+SnapshotView<T>::SnapshotView(SnapshotView&& other) noexcept
+    : m_map(other.m_map), m_map_size(other.m_map_size),
+      m_first(other.m_first), m_count(other.m_count) {
+    other.m_map      = nullptr;
+    other.m_map_size = 0;
+    other.m_first    = nullptr;
+    other.m_count    = 0;
+}
+
+/// Unmaps the snapshot. Pointers to its elements become invalid.
+template <class T>
+SnapshotView<T>::~SnapshotView() {
+    if (m_map != nullptr) {
+        ::munmap(m_map, m_map_size);
+    }
+}
+
+/// Returns a reference to the element at specified location pos, with
+/// bounds checking.
+/// @param pos The position of the element to access.
+/// @return    Reference to the element at the specified position.
+/// @throws std::out_of_range if pos >= size().
+template <class T>
+typename SnapshotView<T>::const_reference
+SnapshotView<T>::at(size_type pos) const {
+    // throw exception
+    if (pos >= m_count) {
+        throw std::out_of_range("Out of Range!");
+    }
+
+    return m_first[pos];
+}
+
+#endif  // SNAPSHOT_HPP
+
+// EOF: Snapshot.hpp
@@ -0,0 +1,100 @@
+/// @file Vector-bench.cxx
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file benchmarks the append throughput of the Vector template
+/// against std::vector. Each run appends n integers with push_back, for n
+/// from 10^3 up to 10^max (default 10^8), and reports nanoseconds per element
+/// for the default doubling policy, a 1.5x policy, a pre-reserved Vector and
+/// std::vector.
+///
+/// Example usage:
+/// @code
+///   g++ -O2 Vector-bench.cxx -o vector-bench
+///   ./vector-bench 7        # stop at 10^7 elements
+/// @endcode
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "Vector.hpp"
+
+/// Number of elements appended by all repetitions of a single measurement, so
+/// that small sizes are repeated often enough to be timed reliably.
+const std::size_t WORK = 100000000;
+
+/// Appends n integers to a fresh container, reps times.
+/// @param n    The number of elements to append per repetition.
+/// @param reps The number of repetitions.
+/// @param reserve True to reserve the final size before appending.
+/// @return     The average cost of one push_back, in nanoseconds.
+template <class Container>
+double appendNs(std::size_t n, std::size_t reps, bool reserve = false) {
+    long long checksum = 0;                 // keeps the work observable
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (std::size_t r = 0; r < reps; ++r) {
+        Container c;
+
+        if (reserve) {
+            c.reserve(n);
+        }
+
+        for (std::size_t i = 0; i < n; ++i) {
+            c.push_back(static_cast<int>(i));
+        }
+
+        checksum += c[n - 1] + static_cast<long long>(c.size());
+    }
+
+    const auto stop = std::chrono::steady_clock::now();
+
+    // guard the checksum against dead code elimination
+    if (checksum == -1) {
+        std::cerr << checksum << std::endl;
+    }
+
+    const std::chrono::duration<double, std::nano> elapsed = stop - start;
+    return elapsed.count() / static_cast<double>(n * reps);
+}
+
+/// -------------------------------------------------------------------------
+/// Main entry-point for this application
+///
+/// @returns Exit-code for the process - 0 for success, else an error code.
+/// -------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    // largest power of ten to measure (default 10^8)
+    const int maxExp = argc > 1 ? std::atoi(argv[1]) : 8;
+
+    std::cout << std::left
+              << std::setw(12) << "elements"
+              << std::setw(14) << "Vector x2"
+              << std::setw(14) << "Vector x1.5"
+              << std::setw(14) << "Vector rsv"
+              << std::setw(14) << "std::vector"
+              << "(ns/element)" << std::endl;
+
+    std::size_t n = 1000;
+    for (int exp = 3; exp <= maxExp; ++exp, n *= 10) {
+        const std::size_t reps = WORK / n > 0 ? WORK / n : 1;
+
+        std::cout << std::left << std::fixed << std::setprecision(3)
+                  << std::setw(12) << n
+                  << std::setw(14) << appendNs<Vector<int>>(n, reps)
+                  << std::setw(14)
+                  << appendNs<Vector<int, std::allocator<int>,
+                                     GrowthFactor<3, 2>>>(n, reps)
+                  << std::setw(14) << appendNs<Vector<int>>(n, reps, true)
+                  << std::setw(14) << appendNs<std::vector<int>>(n, reps)
+                  << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+// EOF: Vector-bench.cxx
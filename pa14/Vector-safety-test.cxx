@@ -0,0 +1,201 @@
+/// @file Vector-safety-test.cxx
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file contains Catch2 unit tests for the exception safety of
+/// the Vector class: when an element constructor or the allocator throws
+/// while the vector grows or is copied, the vector must be left as it was,
+/// with no element or storage leaked.
+
+#include <cstddef>  // provides std::size_t
+#include <memory>   // provides std::allocator
+#include <new>      // provides std::bad_alloc
+#include <stdexcept>
+
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+
+#include "Vector.hpp"
+
+/// Element counts its live objects and throws from a copy once a countdown
+/// runs out. Its move constructor may throw, so Vector copies it when it
+/// relocates.
+struct Element {
+    static int live;       ///< Objects constructed and not destroyed
+    static int countdown;  ///< Copies left before one throws; -1 never
+
+    int value;
+
+    explicit Element(int v) : value(v) { ++live; }
+    Element(const Element& other) : value(other.value) {
+        if (countdown == 0) {
+            throw std::runtime_error("copy failed");
+        }
+        if (countdown > 0) {
+            --countdown;
+        }
+        ++live;
+    }
+    Element(Element&& other) : Element(static_cast<const Element&>(other)) {}
+    Element& operator=(const Element& other) = default;
+    ~Element() { --live; }
+};
+
+int Element::live = 0;
+int Element::countdown = -1;
+
+/// LimitedAllocator hands out storage for at most limit elements at a time
+/// and throws std::bad_alloc beyond that.
+template <class T>
+struct LimitedAllocator {
+    using value_type = T;
+
+    std::size_t limit;  ///< Most elements one allocation may hold
+
+    explicit LimitedAllocator(std::size_t most) noexcept : limit(most) {}
+    template <class U>
+    LimitedAllocator(const LimitedAllocator<U>& other) noexcept
+        : limit(other.limit) {}
+
+    T* allocate(std::size_t n) {
+        if (n > limit) {
+            throw std::bad_alloc();
+        }
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T* p, std::size_t n) noexcept {
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    bool operator==(const LimitedAllocator& other) const noexcept {
+        return limit == other.limit;
+    }
+    bool operator!=(const LimitedAllocator& other) const noexcept {
+        return limit != other.limit;
+    }
+};
+
+/// Number of elements in the vectors under test.
+static const int COUNT = 8;
+
+/// Runs operation on a full vector of the elements 0 to COUNT - 1, first
+/// with its first copy throwing, then its second, and so on until it
+/// succeeds. After each throw, checks that the vector is unchanged and that
+/// no element was leaked.
+/// @param operation The operation, taking the vector.
+/// @return          The number of copies the operation made.
+template <class Operation>
+static int throwUntilDone(Operation operation) {
+    for (int copies = 0;; ++copies) {
+        Vector<Element> vector;
+        for (int i = 0; i < COUNT; ++i) {
+            vector.emplace_back(i);
+        }
+        vector.shrink_to_fit();
+        const int live = Element::live;
+
+        Element::countdown = copies;
+        try {
+            operation(vector);
+            Element::countdown = -1;
+            return copies;
+        } catch (const std::runtime_error&) {
+            Element::countdown = -1;
+        }
+
+        REQUIRE(vector.size() == static_cast<std::size_t>(COUNT));
+        CHECK(vector.capacity() == static_cast<std::size_t>(COUNT));
+        for (int i = 0; i < COUNT; ++i) {
+            CHECK(vector[i].value == i);
+        }
+        CHECK(Element::live == live);
+    }
+}
+
+TEST_CASE("Vector growth with a throwing element", "[Vector]") {
+    const Element extra(-1);
+    const Element range[] = {Element(-2), Element(-3)};
+    const int live = Element::live;
+
+    SECTION("emplace_back") {
+        CHECK(throwUntilDone([&](Vector<Element>& vector) {
+                  vector.emplace_back(extra);
+              }) == COUNT + 1);
+    }
+
+    SECTION("insert") {
+        CHECK(throwUntilDone([&](Vector<Element>& vector) {
+                  vector.insert(vector.begin() + 3, extra);
+              }) == COUNT + 1);
+    }
+
+    SECTION("range insert") {
+        CHECK(throwUntilDone([&](Vector<Element>& vector) {
+                  vector.insert(vector.begin() + 5, range, range + 2);
+              }) == COUNT + 2);
+    }
+
+    SECTION("reserve") {
+        CHECK(throwUntilDone([&](Vector<Element>& vector) {
+                  vector.reserve(2 * COUNT);
+              }) == COUNT);
+    }
+
+    CHECK(Element::live == live);
+}
+
+TEST_CASE("Vector copies with a throwing element", "[Vector]") {
+    Vector<Element> larger;
+    for (int i = 0; i < 2 * COUNT; ++i) {
+        larger.emplace_back(-i);
+    }
+    const int live = Element::live;
+
+    SECTION("copy constructor") {
+        CHECK(throwUntilDone([](Vector<Element>& vector) {
+                  Vector<Element> copy(vector);
+              }) == COUNT);
+    }
+
+    SECTION("copy assignment into new storage") {
+        CHECK(throwUntilDone([&](Vector<Element>& vector) {
+                  vector = larger;
+              }) == 2 * COUNT);
+    }
+
+    SECTION("copy assignment into spare capacity") {
+        Vector<Element> target;
+        target.reserve(2 * COUNT);
+        target.emplace_back(1);
+        target.emplace_back(2);
+        const int before = Element::live;
+
+        // the third copy throws, after two elements were built past size()
+        Element::countdown = 2;
+        CHECK_THROWS_AS(target = larger, std::runtime_error);
+        Element::countdown = -1;
+        CHECK(target.size() == 2);
+        CHECK(Element::live == before);
+    }
+
+    CHECK(Element::live == live);
+}
+
+TEST_CASE("Vector copy assignment whose allocation throws", "[Vector]") {
+    Vector<int, LimitedAllocator<int>> source{LimitedAllocator<int>(100)};
+    Vector<int, LimitedAllocator<int>> target{LimitedAllocator<int>(10)};
+    for (int i = 0; i < 50; ++i) {
+        source.push_back(i);
+    }
+    for (int i = 0; i < 5; ++i) {
+        target.push_back(-i);
+    }
+
+    // the old storage is kept, and freed once by the destructor
+    CHECK_THROWS_AS(target = source, std::bad_alloc);
+    REQUIRE(target.size() == 5);
+    CHECK(target.capacity() >= 5);
+    CHECK(target[4] == -4);
+}
+
+// EOF: Vector-safety-test.cxx
@@ -89,6 +89,11 @@ int main() {
     // output values
     printStatistics(counter);
 
+#ifdef VECTOR_STATS
+    // report the memory traffic of all Vectors on the error stream
+    std::cerr << vector_global_stats();
+#endif
+
     return exitState;
 }
 
@@ -0,0 +1,182 @@
+/// @file Compact-bench.cxx
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file compares the memory use and traversal speed of
+/// CompactLList against LList. Both lists are filled with n ints, then
+/// churned by n random erase/insert pairs, which scatters the nodes in
+/// memory; the report lists the heap bytes per element and the time to walk
+/// the list per element when filled, after churning, and for CompactLList
+/// after compact().
+///
+/// Example usage:
+/// @code
+///   g++ -O2 Compact-bench.cxx -o compact-bench
+///   ./compact-bench 100000    # 10^5 elements (default 10^6)
+/// @endcode
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "LList.hpp"
+#include "CompactLList.hpp"
+
+/// Bytes allocated through operator new and not deleted yet.
+static std::size_t g_liveBytes = 0;
+
+/// Room kept in front of each allocation to remember its size.
+static const std::size_t HEADER = alignof(std::max_align_t);
+
+/// Allocates size bytes, counting them in g_liveBytes.
+void* operator new(std::size_t size) {
+    void* block = std::malloc(size + HEADER);
+    if (block == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    *static_cast<std::size_t*>(block) = size;
+    g_liveBytes += size;
+    return static_cast<char*>(block) + HEADER;
+}
+
+/// Frees a block of operator new, uncounting it from g_liveBytes.
+void operator delete(void* ptr) noexcept {
+    if (ptr != nullptr) {
+        char* block = static_cast<char*>(ptr) - HEADER;
+        g_liveBytes -= *reinterpret_cast<std::size_t*>(block);
+        std::free(block);
+    }
+}
+
+void* operator new[](std::size_t size) { return operator new(size); }
+void operator delete[](void* ptr) noexcept { operator delete(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { operator delete(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept {
+    operator delete(ptr);
+}
+
+/// Returns the fastest of several walks over list, in nanoseconds per
+/// element.
+/// @param list The list to walk.
+/// @return     The time per element, in nanoseconds.
+template <class List>
+double traverseNs(const List& list) {
+    double best = 0;
+
+    for (int rep = 0; rep < 5; ++rep) {
+        const auto start = std::chrono::steady_clock::now();
+
+        long long sum = 0;
+        for (auto it = list.begin(); it != list.end(); ++it) {
+            sum += *it;
+        }
+
+        const std::chrono::duration<double, std::nano> elapsed =
+            std::chrono::steady_clock::now() - start;
+        const double ns = elapsed.count() / list.size();
+        if (rep == 0 || ns < best) {
+            best = ns;
+        }
+        if (sum == 42) {
+            std::cout << "";    // keeps the walk from being optimized out
+        }
+    }
+
+    return best;
+}
+
+/// Erases and reinserts n elements at random positions of list, through
+/// iterators kept for every element.
+/// @param list The list to churn.
+/// @param n    The number of erase/insert pairs.
+template <class List>
+void churn(List& list, std::size_t n) {
+    std::vector<typename List::iterator> its;
+    its.reserve(list.size());
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        its.push_back(it);
+    }
+
+    std::mt19937 random(1);
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::size_t victim = random() % its.size();
+        const std::size_t place  = random() % its.size();
+
+        const int value = *its[victim];
+        list.erase(its[victim]);
+        its[victim] = list.insert(place != victim ? its[place] : list.end(),
+                                  value);
+    }
+}
+
+/// Prints one line of the report.
+/// @param name  The list and its state.
+/// @param bytes The heap bytes per element.
+/// @param ns    The traversal time per element, in nanoseconds.
+void printRow(const char* name, double bytes, double ns) {
+    std::cout << std::left << std::fixed << std::setprecision(2)
+              << std::setw(24) << name << std::setw(12) << bytes << ns
+              << std::endl;
+}
+
+/// Fills, measures and churns a List of n elements; a CompactLList is
+/// measured once more after compact().
+/// @param name The name of the list.
+/// @param n    The number of elements.
+template <class List>
+void measure(const char* name, std::size_t n) {
+    const std::size_t before = g_liveBytes;
+
+    List list;
+    for (std::size_t i = 0; i < n; ++i) {
+        list.push_back(static_cast<int>(i));
+    }
+    const double bytes = static_cast<double>(g_liveBytes - before) / n;
+
+    const std::string label = name;
+    printRow((label + " filled").c_str(), bytes, traverseNs(list));
+
+    churn(list, n);
+    printRow((label + " churned").c_str(),
+             static_cast<double>(g_liveBytes - before) / n, traverseNs(list));
+
+    if constexpr (std::is_same<List, CompactLList<int>>::value) {
+        list.compact();
+        printRow((label + " compacted").c_str(),
+                 static_cast<double>(g_liveBytes - before) / n,
+                 traverseNs(list));
+    }
+}
+
+/// -------------------------------------------------------------------------
+/// Main entry-point for this application
+///
+/// @returns Exit-code for the process - 0 for success, else an error code.
+/// -------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    // number of elements (default 10^6)
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10)
+                                   : 1000000;
+    if (n == 0) {
+        std::cerr << "usage: compact-bench [elements > 0]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << n << " ints" << std::endl;
+    std::cout << std::left << std::setw(24) << "list" << std::setw(12)
+              << "bytes/elem" << "ns/elem" << std::endl;
+
+    measure<LList<int>>("LList", n);
+    measure<CompactLList<int>>("CompactLList", n);
+
+    return EXIT_SUCCESS;
+}
+
+// EOF: Compact-bench.cxx
@@ -0,0 +1,333 @@
+/// @file CompactLList-test.cxx
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file contains Catch2 unit tests for the CompactLList class:
+/// its LList interface against std::list, growing the arena while the new
+/// element is taken from the list itself, and compact(), which must keep the
+/// elements in order while rewriting their nodes front to back.
+
+#include <algorithm>
+#include <cstddef>  // provides std::size_t
+#include <cstdint>  // provides std::uint32_t
+#include <iterator>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+
+#include "CompactLList.hpp"
+#include "CompactLList.hpp"  // test include guard
+
+/// Returns a string too long for the small string buffer, so that reading
+/// it after its storage is freed is caught by the sanitizers.
+static std::string longString(int n) {
+    return "a string long enough to live on the heap, number " +
+           std::to_string(n);
+}
+
+/// Checks that list holds the elements of expected, in order.
+template <class T>
+static void checkSame(CompactLList<T>& list, const std::list<T>& expected) {
+    REQUIRE(list.size() == expected.size());
+    CHECK(list.empty() == expected.empty());
+    CHECK(std::equal(list.begin(), list.end(), expected.begin(),
+                     expected.end()));
+}
+
+/// Returns the arena indices of the nodes of list, in list order.
+template <class T>
+static std::vector<std::uint32_t> indices(CompactLList<T>& list) {
+    std::vector<std::uint32_t> result;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        result.push_back(it.index);
+    }
+    return result;
+}
+
+/// Element throws from its copy constructor once a countdown runs out. Its
+/// move constructor may throw, so CompactLList copies it when it moves.
+struct Element {
+    static int live;       ///< Objects constructed and not destroyed
+    static int countdown;  ///< Copies left before one throws; -1 never
+
+    int value;
+
+    explicit Element(int v) : value(v) { ++live; }
+    Element(const Element& other) : value(other.value) {
+        if (countdown == 0) {
+            throw std::runtime_error("copy failed");
+        }
+        if (countdown > 0) {
+            --countdown;
+        }
+        ++live;
+    }
+    Element(Element&& other) : Element(static_cast<const Element&>(other)) {}
+    ~Element() { --live; }
+
+    bool operator==(const Element& other) const {
+        return value == other.value;
+    }
+};
+
+int Element::live = 0;
+int Element::countdown = -1;
+
+TEST_CASE("CompactLList matches std::list", "[CompactLList]") {
+    CompactLList<std::string> list;
+    std::list<std::string> expected;
+
+    SECTION("push, pop, insert and erase") {
+        for (int i = 0; i < 40; ++i) {
+            list.push_back(longString(i));
+            expected.push_back(longString(i));
+            list.push_front(longString(-i));
+            expected.push_front(longString(-i));
+        }
+        checkSame(list, expected);
+        CHECK(list.front() == expected.front());
+        CHECK(list.back() == expected.back());
+
+        list.pop_front();
+        expected.pop_front();
+        list.pop_back();
+        expected.pop_back();
+        list.insert(std::next(list.begin(), 5), "inserted");
+        expected.insert(std::next(expected.begin(), 5), "inserted");
+        list.erase(std::next(list.begin(), 9));
+        expected.erase(std::next(expected.begin(), 9));
+        checkSame(list, expected);
+    }
+
+    SECTION("random edits reuse the free slots") {
+        std::mt19937 random(17);
+        for (int step = 0; step < 5000; ++step) {
+            const std::size_t where = expected.empty()
+                                    ? 0 : random() % expected.size();
+            if (expected.size() < 100 && random() % 2 == 0) {
+                list.insert(std::next(list.begin(), where), longString(step));
+                expected.insert(std::next(expected.begin(), where),
+                                longString(step));
+            } else if (!expected.empty()) {
+                auto it = list.erase(std::next(list.begin(), where));
+                auto exp = expected.erase(std::next(expected.begin(), where));
+                REQUIRE((it == list.end()) == (exp == expected.end()));
+            }
+        }
+        checkSame(list, expected);
+
+        // never more than 100 elements at once, so the arena stopped at 128
+        CHECK(list.capacity() <= 128);
+    }
+
+    SECTION("copy, move and swap") {
+        list = {"a", "b", "c"};
+        CompactLList<std::string> copy(list);
+        list.pop_front();
+        checkSame(copy, {"a", "b", "c"});
+
+        CompactLList<std::string> moved(std::move(copy));
+        CHECK(copy.empty());
+        checkSame(moved, {"a", "b", "c"});
+
+        moved.swap(list);
+        checkSame(moved, {"b", "c"});
+        checkSame(list, {"a", "b", "c"});
+    }
+
+    SECTION("errors") {
+        CHECK_THROWS_AS(list.front(), std::out_of_range);
+        CHECK_THROWS_AS(list.back(), std::out_of_range);
+        CHECK_THROWS_AS(*list.end(), std::runtime_error);
+        CHECK_THROWS_AS(list.erase(list.end()), std::invalid_argument);
+    }
+}
+
+TEST_CASE("CompactLList grows its arena", "[CompactLList]") {
+    CompactLList<std::string> list;
+    CHECK(list.capacity() == 0);
+
+    SECTION("doubling from MIN_ARENA, keeping iterators valid") {
+        const std::size_t minArena = CompactLList<std::string>::MIN_ARENA;
+        list.push_back(longString(0));
+        CHECK(list.capacity() == minArena);
+
+        auto first = list.begin();
+        for (int i = 1; i <= 40; ++i) {
+            list.push_back(longString(i));
+        }
+        CHECK(list.capacity() == 4 * minArena);
+        CHECK(*first == longString(0));
+        CHECK(*std::next(first) == longString(1));
+    }
+
+    SECTION("push_back of an element of the full list") {
+        for (int i = 0; i < 16; ++i) {
+            list.push_back(longString(i));
+        }
+        REQUIRE(list.size() == list.capacity());
+
+        // the argument lives in the arena that push_back replaces
+        list.push_back(list.front());
+        list.push_front(list.back());
+        REQUIRE(list.size() == 18);
+        CHECK(list.capacity() == 32);
+        CHECK(list.front() == longString(0));
+        CHECK(list.back() == longString(0));
+
+        for (int i = 18; i < 32; ++i) {
+            list.push_back(longString(i));
+        }
+        REQUIRE(list.size() == list.capacity());
+        auto middle = std::next(list.begin(), 7);
+        const std::string value = *middle;
+        auto inserted = list.insert(middle, *middle);
+        CHECK(*inserted == value);
+        CHECK(*std::next(inserted) == value);
+    }
+
+    SECTION("emplace_back from an element of the full list") {
+        CompactLList<int> numbers;
+        for (int i = 0; i < 16; ++i) {
+            numbers.push_back(i * 10);
+        }
+        REQUIRE(numbers.size() == numbers.capacity());
+
+        numbers.emplace_back(numbers.back());
+        numbers.emplace_front(*std::next(numbers.begin(), 3));
+        CHECK(numbers.back() == 150);
+        CHECK(numbers.front() == 30);
+        CHECK(numbers.size() == 18);
+    }
+
+    SECTION("a copy that throws while the arena grows") {
+        {
+            CompactLList<Element> elements;
+            for (int i = 0; i < 16; ++i) {
+                elements.emplace_back(i);
+            }
+            const int live = Element::live;
+            const Element extra(99);
+
+            // the new element is copied first, then the 16 old ones
+            for (int copies = 0; copies < 17; ++copies) {
+                Element::countdown = copies;
+                CHECK_THROWS_AS(elements.push_back(extra), std::runtime_error);
+                Element::countdown = -1;
+
+                REQUIRE(elements.size() == 16);
+                CHECK(elements.capacity() == 16);
+                CHECK(Element::live == live + 1);
+                CHECK(elements.back().value == 15);
+            }
+
+            elements.push_back(extra);
+            CHECK(elements.capacity() == 32);
+            CHECK(elements.back().value == 99);
+        }
+        CHECK(Element::live == 0);
+    }
+}
+
+TEST_CASE("CompactLList compact()", "[CompactLList]") {
+    CompactLList<std::string> list;
+    std::list<std::string> expected;
+    for (int i = 0; i < 60; ++i) {
+        list.push_back(longString(i));
+        expected.push_back(longString(i));
+    }
+
+    // churn: erase every third element, then insert at the front, so the
+    // list order no longer matches the arena order
+    auto it = list.begin();
+    auto exp = expected.begin();
+    for (int i = 0; it != list.end(); ++i) {
+        if (i % 3 == 0) {
+            it = list.erase(it);
+            exp = expected.erase(exp);
+        } else {
+            ++it;
+            ++exp;
+        }
+    }
+    for (int i = 0; i < 10; ++i) {
+        list.push_front(longString(100 + i));
+        expected.push_front(longString(100 + i));
+    }
+    const std::size_t capacity = list.capacity();
+
+    SECTION("rewrites the nodes in list order") {
+        REQUIRE(indices(list).front() != 0);
+
+        list.compact();
+        checkSame(list, expected);
+        CHECK(list.capacity() == capacity);
+
+        std::vector<std::uint32_t> order = indices(list);
+        for (std::uint32_t i = 0; i < order.size(); ++i) {
+            REQUIRE(order[i] == i);
+        }
+
+        // walking backward still works, and new nodes follow the old ones
+        auto last = std::next(list.begin(), list.size() - 1);
+        CHECK(last.index == list.size() - 1);
+        CHECK(*last == expected.back());
+        CHECK(std::prev(last).index == list.size() - 2);
+
+        list.push_back("after");
+        expected.push_back("after");
+        CHECK(indices(list).back() == expected.size() - 1);
+        checkSame(list, expected);
+    }
+
+    SECTION("an empty list") {
+        list.clear();
+        list.compact();
+        CHECK(list.empty());
+        list.push_back("x");
+        checkSame(list, {"x"});
+    }
+
+    SECTION("twice in a row") {
+        list.compact();
+        list.compact();
+        checkSame(list, expected);
+        CHECK(indices(list).back() == expected.size() - 1);
+    }
+}
+
+TEST_CASE("CompactLList compact() with a throwing copy", "[CompactLList]") {
+    {
+        CompactLList<Element> elements;
+        for (int i = 0; i < 20; ++i) {
+            elements.emplace_back(i);
+        }
+        elements.erase(elements.begin());
+        elements.emplace_front(-1);
+        const int live = Element::live;
+        const std::vector<std::uint32_t> before = indices(elements);
+
+        for (int copies = 0; copies < 20; ++copies) {
+            Element::countdown = copies;
+            CHECK_THROWS_AS(elements.compact(), std::runtime_error);
+            Element::countdown = -1;
+
+            CHECK(Element::live == live);
+            CHECK(indices(elements) == before);
+            CHECK(elements.front().value == -1);
+        }
+
+        elements.compact();
+        CHECK(indices(elements).front() == 0);
+        CHECK(elements.size() == 20);
+        CHECK(Element::live == live);
+    }
+    CHECK(Element::live == 0);
+}
+
+// EOF: CompactLList-test.cxx
@@ -0,0 +1,744 @@
+/// @file CompactLList.hpp
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This header file contains the class "CompactLList", a doubly
+/// linked list whose nodes live side by side in one growable array (the
+/// arena) and link to each other by 32-bit indices instead of pointers. A
+/// node of ints takes 12 bytes instead of LList's 24, and compact() rewrites
+/// the nodes in list order, so that walking the list after heavy insertion
+/// and erasure reads the arena front to back again. It offers the interface
+/// of LList (push_*, pop_*, emplace*, insert, erase and a bidirectional
+/// iterator).
+///
+/// Example usage:
+/// @code
+///   CompactLList<int> list = {1, 2, 3};
+///   list.insert(std::next(list.begin()), 4);    // 1 4 2 3
+///   list.erase(list.begin());                   // 4 2 3
+///   list.compact();                             // nodes 0, 1, 2 in order
+///   for (int value : list) { std::cout << value << ' '; }
+/// @endcode
+
+// Definitions
+#ifndef COMPACT_LLIST_HPP
+#define COMPACT_LLIST_HPP
+
+// Preprocessor Directive(s)
+#include <cstddef>  // provides std::size_t
+#include <cstdint>  // provides std::uint32_t
+#include <cstring>  // provides std::memcpy
+#include <initializer_list>
+#include <iterator>
+#include <new>      // provides placement new and std::launder
+#include <stdexcept>
+#include <type_traits>
+#include <utility>  // provides std::forward, std::move and std::swap
+
+/* ========================================================================== */
+/* ========== Class/Struct Definition(s) ========= */
+/* ========================================================================== */
+/// CompactSlot is one node of a CompactLList: the indices of the previous and
+/// next nodes and room for one element, constructed while the slot is in
+/// use. A free slot links the free list through next.
+template <class T>
+struct CompactSlot {
+    /// Returns a pointer to the element of the slot.
+    T* item() { return std::launder(reinterpret_cast<T*>(storage)); }
+
+    std::uint32_t prev;  ///< Index of the previous node
+    std::uint32_t next;  ///< Index of the next node, or of the next free slot
+    alignas(T) unsigned char storage[sizeof(T)];  ///< The element
+};  // End: struct CompactSlot
+
+
+/// CompactLList is a doubly-linked list stored in an arena of slots. Slots
+/// are taken from a free list of erased nodes first, then from the unused
+/// end of the arena, which doubles in size when it is full. Indices survive
+/// the growth of the arena, so iterators stay valid until their element is
+/// erased or compact() is called; references and pointers to the elements
+/// are invalidated when the arena grows, as with Vector.
+///
+/// @tparam T Type of the elements.
+template <class T>
+class CompactLList {
+    using slot_type = CompactSlot<T>;
+
+public:
+    /// Index of no node: the end of the list and of the free list.
+    static const std::uint32_t NIL = 0xFFFFFFFF;
+    /// Slots in the arena once the first element is added.
+    static const std::size_t MIN_ARENA = 16;
+
+    /// The BiDirectionalIterator struct iterates over the elements of a
+    /// CompactLList in both directions. It designates an element by its list
+    /// and the index of its node; the end iterator has the index NIL. Like
+    /// LList's iterator, it throws when dereferenced, incremented or
+    /// decremented at the end.
+    struct BiDirectionalIterator {
+        // Iterator traits
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        /// Constructor: BiDirectionalIterator
+        /// Designates node pos of list owner, or the end (default).
+        explicit BiDirectionalIterator(CompactLList* owner = nullptr,
+                                       std::uint32_t pos = NIL)
+        : list(owner), index(pos) {};
+
+        // Dereference operators
+        reference operator*() const;
+        pointer operator->() const { return &**this; }
+
+        // Increment/decrement operators
+        BiDirectionalIterator& operator++();
+        BiDirectionalIterator operator++(int ignored);
+        BiDirectionalIterator& operator--();
+        BiDirectionalIterator operator--(int ignored);
+
+        // Equality/Inequality comparison operators
+        /// Checks if two iterators are/not designating the same element.
+        bool operator==(const BiDirectionalIterator& other) const
+        { return index == other.index; }
+        bool operator!=(const BiDirectionalIterator& other) const
+        { return index != other.index; }
+
+        CompactLList* list;   ///< List holding the element
+        std::uint32_t index;  ///< Index of the element's node in the arena
+    };  // End: struct BiDirectionalIterator
+
+    // types
+    using value_type = T;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = BiDirectionalIterator;
+    using const_iterator = const iterator;
+
+    // construct/copy/destroy
+    /// Constructor: CompactLList
+    /// Initializes an empty list without an arena.
+    CompactLList()
+        : slots(nullptr), arenaSize(0), used(0), freeList(NIL), head(NIL),
+          tail(NIL), count(0) {};
+    CompactLList(const CompactLList& other);
+    CompactLList(CompactLList&& other) noexcept;
+    CompactLList(std::initializer_list<T> ilist);
+    virtual ~CompactLList();
+
+    // assignment
+    CompactLList& operator=(const CompactLList& other);
+    CompactLList& operator=(CompactLList&& other) noexcept;
+    CompactLList& operator=(std::initializer_list<T> ilist);
+
+    // iterators
+    /// Returns an iterator pointing to the first element / past the last.
+    iterator       begin() noexcept { return iterator(this, head); }
+    const_iterator begin() const noexcept { return iterator(self(), head); }
+    iterator       end() noexcept { return iterator(this); }
+    const_iterator end() const noexcept { return iterator(self()); }
+
+    // capacity
+    /// Returns true if the list is empty, otherwise false, the number of
+    /// elements in the list and the number of slots in the arena.
+    bool empty() const noexcept { return head == NIL; }
+    size_type size() const noexcept { return count; }
+    size_type capacity() const noexcept { return arenaSize; }
+    void      reserve(size_type slotCount);
+
+    // element access
+    reference       front();
+    const_reference front() const;
+    reference       back();
+    const_reference back() const;
+
+    // modifiers
+    void     push_front(const T& value);
+    void     push_front(T&& value);
+    void     pop_front();
+    void     push_back(const T& value);
+    void     push_back(T&& value);
+    void     pop_back();
+    iterator insert(const_iterator position, const T& value);
+    iterator insert(const_iterator position, T&& value);
+    iterator erase(const_iterator position);
+
+    template <class... Args>
+    reference emplace_front(Args&&... args);
+    template <class... Args>
+    reference emplace_back(Args&&... args);
+    template <class... Args>
+    iterator  emplace(const_iterator position, Args&&... args);
+    void     swap(CompactLList& other) noexcept;
+    void     clear() noexcept;
+
+    // operations
+    void compact();
+
+private:
+    /// Returns this list; const begin() and end() need it without const.
+    CompactLList* self() const noexcept {
+        return const_cast<CompactLList*>(this);
+    }
+
+    template <class... Args>
+    std::uint32_t createSlot(Args&&... args);
+    void          destroySlot(std::uint32_t index) noexcept;
+    void          relocate(slot_type* arena, size_type size);
+    void          linkSlot(std::uint32_t position,
+                           std::uint32_t index) noexcept;
+    void          unlinkSlot(std::uint32_t index) noexcept;
+
+    slot_type*    slots;      ///< The arena
+    size_type     arenaSize;  ///< Number of slots in the arena
+    std::uint32_t used;       ///< Slots ever handed out, from the front
+    std::uint32_t freeList;   ///< First slot of the erased nodes
+    std::uint32_t head;
+    std::uint32_t tail;
+    size_type     count;
+};  // End: class CompactLList
+
+
+/* ========================================================================== */
+/* ========== Function Implementations ========== */
+/* ========================================================================== */
+
+/* ========== Constructor/Copy/Destructor: All ========== */
+/// Copy: CompactLList
+/// Initializes a new list by copying the elements of other into an arena of
+/// its size, in list order.
+template <class T>
+CompactLList<T>::CompactLList(const CompactLList& other) : CompactLList() {
+    this->reserve(other.count);
+    for (const T& item : other) {
+        this->push_back(item);
+    }
+}
+
+/// Move: CompactLList
+/// Takes over the arena of other, leaving other empty.
+template <class T>
+CompactLList<T>::CompactLList(CompactLList&& other) noexcept
+    : CompactLList() {
+    this->swap(other);
+}
+
+/// Constructor: CompactLList std::initializer_list<T>
+/// Initializes the list with the elements of ilist, in order.
+template <class T>
+CompactLList<T>::CompactLList(std::initializer_list<T> ilist)
+    : CompactLList() {
+    this->reserve(ilist.size());
+    for (const T& item : ilist) {
+        this->push_back(item);
+    }
+}
+
+/// Destructor: CompactLList
+/// Destroys every element and frees the arena.
+template <class T>
+CompactLList<T>::~CompactLList() {
+    this->clear();
+    delete[] slots;
+}
+
+/* ======== Dereference/Increment Operators: BiDirectionalIterator ======== */
+/// Reference Operator*(): BiDirectionalIterator
+/// Returns a reference to the designated element.
+template <class T>
+typename CompactLList<T>::BiDirectionalIterator::reference
+         CompactLList<T>::BiDirectionalIterator::operator*() const {
+    // Verify the iterator designates an element
+    if (index == NIL) {
+        throw std::runtime_error("Dereferencing a null iterator");
+    }
+
+    return *list->slots[index].item();
+}
+
+/// Operator++(): BiDirectionalIterator&
+/// Prefix increment. Advances the iterator to the next element.
+template <class T>
+typename CompactLList<T>::BiDirectionalIterator&
+         CompactLList<T>::BiDirectionalIterator::operator++() {
+    if (index == NIL) {
+        throw std::runtime_error("Error: Attempt to increment null iterator.");
+    }
+
+    index = list->slots[index].next;
+    return *this;
+}
+
+/// Operator++(int ignored): BiDirectionalIterator
+/// Postfix increment. Advances the iterator but returns it as it was before.
+template <class T>
+typename CompactLList<T>::BiDirectionalIterator
+         CompactLList<T>::BiDirectionalIterator::operator++(int) {
+    BiDirectionalIterator copy = *this;
+
+    operator++();
+    return copy;
+}
+
+/// Operator--(): BiDirectionalIterator&
+/// Prefix decrement. Moves the iterator to the previous element; moving
+/// before the first element gives the end iterator.
+template <class T>
+typename CompactLList<T>::BiDirectionalIterator&
+         CompactLList<T>::BiDirectionalIterator::operator--() {
+    if (index == NIL) {
+        throw std::runtime_error("Error: Attempt to decrement null iterator.");
+    }
+
+    index = list->slots[index].prev;
+    return *this;
+}
+
+/// Operator--(int ignored): BiDirectionalIterator
+/// Postfix decrement. Moves the iterator back but returns it as it was
+/// before.
+template <class T>
+typename CompactLList<T>::BiDirectionalIterator
+         CompactLList<T>::BiDirectionalIterator::operator--(int) {
+    BiDirectionalIterator copy = *this;
+
+    operator--();
+    return copy;
+}
+
+/* ========== Assignment: CompactLList ========== */
+/// Operator=(const CompactLList& other): CompactLList
+/// Copy assignment operator. Clears the list, then copies other into it,
+/// keeping the arena if it is large enough.
+template <class T>
+CompactLList<T>& CompactLList<T>::operator=(const CompactLList& other) {
+    if (this != &other) {
+        this->clear();
+        this->reserve(other.count);
+        for (const T& item : other) {
+            this->push_back(item);
+        }
+    }
+
+    return *this;
+}
+
+/// Operator=(CompactLList&& other): CompactLList
+/// Move assignment operator. Swaps the arenas; other's destructor frees the
+/// old elements.
+template <class T>
+CompactLList<T>& CompactLList<T>::operator=(CompactLList&& other) noexcept {
+    if (this != &other) {
+        CompactLList temp(std::move(other));
+        this->swap(temp);
+    }
+
+    return *this;
+}
+
+/// Operator=(std::initializer_list<T> ilist): CompactLList
+/// Clears the list, then appends each element of ilist.
+template <class T>
+CompactLList<T>& CompactLList<T>::operator=(std::initializer_list<T> ilist) {
+    this->clear();
+    this->reserve(ilist.size());
+    for (const T& item : ilist) {
+        this->push_back(item);
+    }
+
+    return *this;
+}
+
+/* ========== Capacity: CompactLList ========== */
+/// Void reserve(size_type slotCount): CompactLList
+/// Grows the arena to at least slotCount slots, so that the list can hold
+/// that many elements without growing again. Indices are kept.
+template <class T>
+void CompactLList<T>::reserve(size_type slotCount) {
+    if (slotCount <= arenaSize) {
+        return;
+    }
+    if (slotCount > NIL) {
+        throw std::length_error("CompactLList: more than 2^32 - 1 nodes");
+    }
+
+    slot_type* arena = new slot_type[slotCount];
+    try {
+        relocate(arena, slotCount);
+    } catch (...) {
+        delete[] arena;
+        throw;
+    }
+}
+
+/* ========== Element Access: CompactLList ========== */
+/// Reference front(): CompactLList
+/// Returns a reference to the first element in the list.
+template <class T>
+typename CompactLList<T>::reference CompactLList<T>::front() {
+    if (head == NIL) {
+        throw std::out_of_range("Accessing front on an empty list");
+    }
+
+    return *slots[head].item();
+}
+
+/// Const_reference front() const: CompactLList
+/// Returns a reference to the first element in the list.
+template <class T>
+typename CompactLList<T>::const_reference CompactLList<T>::front() const {
+    if (head == NIL) {
+        throw std::out_of_range("Accessing front on an empty list");
+    }
+
+    return *slots[head].item();
+}
+
+/// Reference back(): CompactLList
+/// Returns a reference to the last element in the list.
+template <class T>
+typename CompactLList<T>::reference CompactLList<T>::back() {
+    if (tail == NIL) {
+        throw std::out_of_range("Accessing back on an empty list");
+    }
+
+    return *slots[tail].item();
+}
+
+/// Const_reference back() const: CompactLList
+/// Returns a reference to the last element in the list.
+template <class T>
+typename CompactLList<T>::const_reference CompactLList<T>::back() const {
+    if (tail == NIL) {
+        throw std::out_of_range("Accessing back on an empty list");
+    }
+
+    return *slots[tail].item();
+}
+
+/* ========== Modifiers: CompactLList ========== */
+/// Void push_front(const T& value): CompactLList
+/// Adds a copy of value at the front of the list.
+template <class T>
+void CompactLList<T>::push_front(const T& value) {
+    emplace_front(value);
+}
+
+/// Void push_front(T&& value): CompactLList
+/// Adds value at the front of the list, moving it into the node.
+template <class T>
+void CompactLList<T>::push_front(T&& value) {
+    emplace_front(std::move(value));
+}
+
+/// Void pop_front(): CompactLList
+/// Removes the first element of the list, if any.
+template <class T>
+void CompactLList<T>::pop_front() {
+    if (head != NIL) {
+        erase(begin());
+    }
+}
+
+/// Void push_back(const T& value): CompactLList
+/// Adds a copy of value at the end of the list.
+template <class T>
+void CompactLList<T>::push_back(const T& value) {
+    emplace_back(value);
+}
+
+/// Void push_back(T&& value): CompactLList
+/// Adds value at the end of the list, moving it into the node.
+template <class T>
+void CompactLList<T>::push_back(T&& value) {
+    emplace_back(std::move(value));
+}
+
+/// Void pop_back(): CompactLList
+/// Removes the last element of the list, if any.
+template <class T>
+void CompactLList<T>::pop_back() {
+    if (tail != NIL) {
+        erase(iterator(this, tail));
+    }
+}
+
+/// Iterator insert(const_iterator position, const T& value): CompactLList
+/// Inserts a copy of value before position.
+/// Returns an iterator pointing to the new element.
+template <class T>
+typename CompactLList<T>::iterator
+         CompactLList<T>::insert(const_iterator position, const T& value) {
+    return emplace(position, value);
+}
+
+/// Iterator insert(const_iterator position, T&& value): CompactLList
+/// Inserts value before position, moving it into the node.
+/// Returns an iterator pointing to the new element.
+template <class T>
+typename CompactLList<T>::iterator
+         CompactLList<T>::insert(const_iterator position, T&& value) {
+    return emplace(position, std::move(value));
+}
+
+/// Iterator erase(const_iterator position): CompactLList
+/// Removes the element at position; its slot goes to the free list.
+/// Returns the iterator following the removed element.
+template <class T>
+typename CompactLList<T>::iterator
+         CompactLList<T>::erase(const_iterator position) {
+    // Verify position designates an element
+    if (position.index == NIL) {
+        throw std::invalid_argument("Out of Range!");
+    }
+
+    const std::uint32_t next = slots[position.index].next;
+    unlinkSlot(position.index);
+    destroySlot(position.index);
+    --count;
+
+    return iterator(this, next);
+}
+
+/// Reference emplace_front(Args&&... args): CompactLList
+/// Constructs an element from args at the front of the list.
+/// Returns a reference to the new element.
+template <class T>
+template <class... Args>
+typename CompactLList<T>::reference
+         CompactLList<T>::emplace_front(Args&&... args) {
+    return *emplace(begin(), std::forward<Args>(args)...);
+}
+
+/// Reference emplace_back(Args&&... args): CompactLList
+/// Constructs an element from args at the end of the list.
+/// Returns a reference to the new element.
+template <class T>
+template <class... Args>
+typename CompactLList<T>::reference
+         CompactLList<T>::emplace_back(Args&&... args) {
+    return *emplace(end(), std::forward<Args>(args)...);
+}
+
+/// Iterator emplace(const_iterator position, Args&&... args): CompactLList
+/// Constructs an element from args before position. args may refer to an
+/// element of the list even if the arena has to grow.
+/// Returns an iterator pointing to the new element.
+template <class T>
+template <class... Args>
+typename CompactLList<T>::iterator
+         CompactLList<T>::emplace(const_iterator position, Args&&... args) {
+    const std::uint32_t index = createSlot(std::forward<Args>(args)...);
+
+    linkSlot(position.index, index);
+    ++count;
+
+    return iterator(this, index);
+}
+
+/// Void swap(CompactLList& other) noexcept: CompactLList
+/// Swaps the arenas of the list and other.
+template <class T>
+void CompactLList<T>::swap(CompactLList& other) noexcept {
+    std::swap(slots, other.slots);
+    std::swap(arenaSize, other.arenaSize);
+    std::swap(used, other.used);
+    std::swap(freeList, other.freeList);
+    std::swap(head, other.head);
+    std::swap(tail, other.tail);
+    std::swap(count, other.count);
+}
+
+/// Void clear() noexcept: CompactLList
+/// Destroys every element, keeping the arena for the next ones.
+template <class T>
+void CompactLList<T>::clear() noexcept {
+    if (!std::is_trivially_destructible<T>::value) {
+        for (std::uint32_t i = head; i != NIL; i = slots[i].next) {
+            slots[i].item()->~T();
+        }
+    }
+
+    used = 0;
+    freeList = NIL;
+    head = NIL;
+    tail = NIL;
+    count = 0;
+}
+
+/* ========== Operations: CompactLList ========== */
+/// Void compact(): CompactLList
+/// Rewrites the nodes into a new arena of the same size in list order: the
+/// first element goes to slot 0, the next to slot 1 and so on, and the free
+/// slots follow. Walking the list then reads the arena front to back.
+/// Invalidates all iterators. If moving an element throws, the list is left
+/// unchanged.
+template <class T>
+void CompactLList<T>::compact() {
+    if (count == 0) {
+        clear();
+        return;
+    }
+
+    slot_type*    arena = new slot_type[arenaSize];
+    std::uint32_t moved = 0;
+
+    try {
+        for (std::uint32_t i = head; i != NIL; i = slots[i].next, ++moved) {
+            ::new (arena[moved].storage)
+                T(std::move_if_noexcept(*slots[i].item()));
+            arena[moved].prev = moved - 1;      // NIL for the first node
+            arena[moved].next = moved + 1;
+        }
+    } catch (...) {
+        for (std::uint32_t i = 0; i < moved; ++i) {
+            arena[i].item()->~T();
+        }
+        delete[] arena;
+        throw;
+    }
+    arena[moved - 1].next = NIL;
+
+    clear();
+    delete[] slots;
+
+    slots = arena;
+    used = moved;
+    head = 0;
+    tail = moved - 1;
+    count = moved;
+}
+
+/* ========== Private Helpers: CompactLList ========== */
+/// Std::uint32_t createSlot(Args&&... args): CompactLList
+/// Constructs an element from args in a free slot, growing the arena if
+/// there is none. The element is constructed before the old arena is
+/// released, as args may refer into it.
+/// Returns the index of the slot, which is not linked yet.
+template <class T>
+template <class... Args>
+std::uint32_t CompactLList<T>::createSlot(Args&&... args) {
+    if (freeList != NIL) {
+        const std::uint32_t index = freeList;
+
+        ::new (slots[index].storage) T(std::forward<Args>(args)...);
+        freeList = slots[index].next;
+        return index;
+    }
+
+    if (used < arenaSize) {
+        ::new (slots[used].storage) T(std::forward<Args>(args)...);
+        return used++;
+    }
+
+    if (arenaSize == NIL) {
+        throw std::length_error("CompactLList: more than 2^32 - 1 nodes");
+    }
+
+    size_type size = arenaSize > 0 ? 2 * arenaSize : MIN_ARENA;
+    if (size > NIL) {
+        size = NIL;
+    }
+
+    slot_type* arena = new slot_type[size];
+    try {
+        ::new (arena[used].storage) T(std::forward<Args>(args)...);
+    } catch (...) {
+        delete[] arena;
+        throw;
+    }
+
+    try {
+        relocate(arena, size);
+    } catch (...) {
+        arena[used].item()->~T();
+        delete[] arena;
+        throw;
+    }
+
+    return used++;
+}
+
+/// Void destroySlot(std::uint32_t index) noexcept: CompactLList
+/// Destroys the element of an unlinked slot and puts the slot on the free
+/// list.
+template <class T>
+void CompactLList<T>::destroySlot(std::uint32_t index) noexcept {
+    slots[index].item()->~T();
+    slots[index].next = freeList;
+    freeList = index;
+}
+
+/// Void relocate(slot_type* arena, size_type size): CompactLList
+/// Moves the nodes into arena, a new array of size slots, each to the same
+/// index, then frees the old arena. If moving an element throws, the
+/// elements moved so far are destroyed, the list is left unchanged and the
+/// caller still owns arena.
+template <class T>
+void CompactLList<T>::relocate(slot_type* arena, size_type size) {
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        if (used > 0) {
+            std::memcpy(arena, slots, used * sizeof(slot_type));
+        }
+    } else {
+        std::uint32_t i = head;
+        try {
+            for (; i != NIL; i = slots[i].next) {
+                ::new (arena[i].storage)
+                    T(std::move_if_noexcept(*slots[i].item()));
+            }
+        } catch (...) {
+            for (std::uint32_t j = head; j != i; j = slots[j].next) {
+                arena[j].item()->~T();
+            }
+            throw;
+        }
+
+        for (std::uint32_t j = 0; j < used; ++j) {
+            arena[j].prev = slots[j].prev;
+            arena[j].next = slots[j].next;
+        }
+        for (std::uint32_t j = head; j != NIL; j = slots[j].next) {
+            slots[j].item()->~T();
+        }
+    }
+
+    delete[] slots;
+    slots = arena;
+    arenaSize = size;
+}
+
+/// Void linkSlot(std::uint32_t position, std::uint32_t index): CompactLList
+/// Links the node at index before position, or at the end if position is
+/// NIL. count is left to the caller.
+template <class T>
+void CompactLList<T>::linkSlot(std::uint32_t position,
+                               std::uint32_t index) noexcept {
+    const std::uint32_t prevIndex = position != NIL ? slots[position].prev
+                                                    : tail;
+
+    slots[index].prev = prevIndex;
+    slots[index].next = position;
+    (prevIndex != NIL ? slots[prevIndex].next : head) = index;
+    (position != NIL ? slots[position].prev : tail) = index;
+}
+
+/// Void unlinkSlot(std::uint32_t index) noexcept: CompactLList
+/// Unlinks the node at index from the list, joining its neighbors. count is
+/// left to the caller.
+template <class T>
+void CompactLList<T>::unlinkSlot(std::uint32_t index) noexcept {
+    const std::uint32_t prevIndex = slots[index].prev;
+    const std::uint32_t nextIndex = slots[index].next;
+
+    (prevIndex != NIL ? slots[prevIndex].next : head) = nextIndex;
+    (nextIndex != NIL ? slots[nextIndex].prev : tail) = prevIndex;
+}
+
+#endif  // COMPACT_LLIST_HPP
+
+// EOF: CompactLList.hpp
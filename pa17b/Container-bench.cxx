@@ -0,0 +1,56 @@
+/// @file Container-bench.cxx
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file benchmarks the LList, UnrolledLList and CompactLList
+/// templates against std::list with the shared harness in Bench.hpp: push_back, insert and
+/// erase in the middle, iteration, copy and move, for int, std::string and
+/// 64-byte record elements and 10^2 up to 10^max elements (default 10^4).
+/// The results are written to the standard output as CSV (default) or JSON,
+/// so that the output of two revisions can be compared.
+///
+/// Example usage:
+/// @code
+///   g++ -O2 Container-bench.cxx -o container-bench
+///   ./container-bench json 6 > container-bench.json
+/// @endcode
+
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <string>
+
+#include "LList.hpp"
+#include "UnrolledLList.hpp"
+#include "CompactLList.hpp"
+#include "Bench.hpp"
+
+/// UnrolledLList with its default node size, as a template of the element
+/// type alone for the harness.
+template <class T>
+using Unrolled = UnrolledLList<T>;
+
+/// -------------------------------------------------------------------------
+/// Main entry-point for this application
+///
+/// @returns Exit-code for the process - 0 for success, else an error code.
+/// -------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    // output format (csv or json) and largest power of ten (default 10^4)
+    const std::string format = argc > 1 ? argv[1] : "csv";
+    const int maxExp = argc > 2 ? std::atoi(argv[2]) : 4;
+
+    benchSettleHeap();
+
+    BenchReport report;
+    benchSequence<LList>(report, "LList", maxExp);
+    benchSequence<Unrolled>(report, "UnrolledLList", maxExp);
+    benchSequence<CompactLList>(report, "CompactLList", maxExp);
+    benchSequence<std::list>(report, "std::list", maxExp);
+
+    report.write(std::cout, format);
+
+    return EXIT_SUCCESS;
+}
+
+// EOF: Container-bench.cxx
@@ -0,0 +1,226 @@
+/// @file IndexedLList-test.cxx
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file contains Catch2 unit tests for the IndexedLList class:
+/// the positional operations insert_at(), erase_at(), advance() and
+/// index_of() against a std::vector, with the same positions reached again
+/// after iterator inserts and erases, and the index carried over by copy,
+/// move and swap.
+
+#include <cstddef>  // provides std::size_t
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+
+#include "IndexedLList.hpp"
+#include "IndexedLList.hpp"  // test include guard
+
+/// Checks that list holds the elements of expected, in order, and that every
+/// position is reached by advance() and given back by index_of().
+template <class T>
+static void checkSame(const IndexedLList<T>& list,
+                      const std::vector<T>& expected) {
+    REQUIRE(list.size() == expected.size());
+    CHECK(list.empty() == expected.empty());
+
+    std::size_t k = 0;
+    for (auto it = list.begin(); it != list.end(); ++it, ++k) {
+        REQUIRE(*it == expected[k]);
+        REQUIRE(list.advance(k) == it);
+        REQUIRE(list.index_of(it) == k);
+    }
+    CHECK(list.advance(list.size()) == list.end());
+    CHECK(list.index_of(list.end()) == list.size());
+}
+
+// Test the positional operations
+TEST_CASE("IndexedLList positional operations", "[IndexedLList]") {
+    IndexedLList<int> list;
+    std::vector<int>  expected;
+
+    SECTION("empty list") {
+        checkSame(list, expected);
+        CHECK(list.advance(0) == list.end());
+        CHECK_THROWS_AS(list.advance(1), std::out_of_range);
+        CHECK_THROWS_AS(list.erase_at(0), std::out_of_range);
+        CHECK_THROWS_AS(list.insert_at(1, 7), std::out_of_range);
+        CHECK_THROWS_AS(list.front(), std::out_of_range);
+        list.pop_front();
+        list.pop_back();
+        CHECK(list.empty());
+    }
+
+    SECTION("insert_at() at the front, middle and end") {
+        for (int i = 0; i < 200; ++i) {
+            list.insert_at(list.size(), i);
+            expected.push_back(i);
+        }
+        auto it = list.insert_at(0, -1);
+        expected.insert(expected.begin(), -1);
+        CHECK(it == list.begin());
+        it = list.insert_at(100, -2);
+        expected.insert(expected.begin() + 100, -2);
+        CHECK(*it == -2);
+        CHECK(list.index_of(it) == 100);
+        checkSame(list, expected);
+        CHECK(list.front() == -1);
+        CHECK(list.back() == 199);
+    }
+
+    SECTION("erase_at() returns the next element") {
+        for (int i = 0; i < 200; ++i) {
+            list.push_back(i);
+            expected.push_back(i);
+        }
+        auto it = list.erase_at(50);
+        expected.erase(expected.begin() + 50);
+        CHECK(*it == 51);
+        CHECK(list.index_of(it) == 50);
+
+        it = list.erase_at(list.size() - 1);
+        expected.pop_back();
+        CHECK(it == list.end());
+        CHECK(list.back() == 198);
+
+        list.erase_at(0);
+        expected.erase(expected.begin());
+        CHECK_THROWS_AS(list.erase_at(list.size()), std::out_of_range);
+        checkSame(list, expected);
+    }
+
+    SECTION("iterator inserts and erases keep the positions") {
+        for (int i = 0; i < 100; ++i) {
+            list.push_front(i);
+            expected.insert(expected.begin(), i);
+        }
+        auto it = list.insert(list.advance(30), 1000);
+        expected.insert(expected.begin() + 30, 1000);
+        CHECK(list.index_of(it) == 30);
+        list.emplace(list.end(), 2000);
+        expected.push_back(2000);
+        list.erase(list.advance(10));
+        expected.erase(expected.begin() + 10);
+        list.pop_front();
+        list.pop_back();
+        expected.erase(expected.begin());
+        expected.pop_back();
+        checkSame(list, expected);
+        CHECK_THROWS_AS(list.erase(list.end()), std::invalid_argument);
+    }
+
+    SECTION("random edits against std::vector") {
+        std::mt19937 random(22);
+        for (int step = 0; step < 20000; ++step) {
+            const std::size_t size = expected.size();
+            const unsigned    op = random() % 4;
+            if (op < 2 || size < 10) {
+                const std::size_t k = random() % (size + 1);
+                list.insert_at(k, step);
+                expected.insert(expected.begin() + k, step);
+            } else if (op == 2) {
+                const std::size_t k = random() % size;
+                auto it = list.erase_at(k);
+                expected.erase(expected.begin() + k);
+                REQUIRE(list.index_of(it) == k);
+            } else {
+                const std::size_t k = random() % size;
+                auto it = list.advance(k);
+                REQUIRE(*it == expected[k]);
+                REQUIRE(list.index_of(it) == k);
+            }
+            if (expected.size() > 3000) {
+                const std::size_t k = random() % expected.size();
+                list.erase_at(k);
+                expected.erase(expected.begin() + k);
+            }
+        }
+        checkSame(list, expected);
+
+        // emptying it from the back, then refilling it, leaves no stale links
+        while (!list.empty()) {
+            list.pop_back();
+        }
+        expected.clear();
+        checkSame(list, expected);
+        for (int i = 0; i < 500; ++i) {
+            list.insert_at(i / 2, i);
+            expected.insert(expected.begin() + i / 2, i);
+        }
+        checkSame(list, expected);
+    }
+}
+
+// Test copy, move, swap and clear
+TEST_CASE("IndexedLList copy, move, swap and clear", "[IndexedLList]") {
+    std::vector<std::string> letters;
+    IndexedLList<std::string> list;
+    for (int i = 0; i < 300; ++i) {
+        letters.push_back(std::to_string(i));
+        list.push_back(letters.back());
+    }
+
+    SECTION("copy construct and assign") {
+        IndexedLList<std::string> copy(list);
+        list.erase_at(0);
+        checkSame(copy, letters);
+
+        copy.insert_at(150, "copy");
+        IndexedLList<std::string> assigned;
+        assigned = copy;
+        CHECK(*assigned.advance(150) == "copy");
+        CHECK(assigned.index_of(std::next(assigned.begin(), 151)) == 151);
+        CHECK(assigned.size() == 301);
+    }
+
+    SECTION("move construct and assign") {
+        IndexedLList<std::string> moved(std::move(list));
+        CHECK(list.empty());
+        checkSame(moved, letters);
+
+        // the moved-from list is usable
+        list.insert_at(0, "a");
+        checkSame(list, {"a"});
+
+        list = std::move(moved);
+        CHECK(moved.empty());
+        checkSame(list, letters);
+    }
+
+    SECTION("swap") {
+        IndexedLList<std::string> other{"x", "y", "z"};
+        list.swap(other);
+        checkSame(list, {"x", "y", "z"});
+        checkSame(other, letters);
+
+        // each list goes on with the index it took
+        list.insert_at(1, "w");
+        other.erase_at(100);
+        letters.erase(letters.begin() + 100);
+        checkSame(list, {"x", "w", "y", "z"});
+        checkSame(other, letters);
+
+        IndexedLList<std::string> empty;
+        empty.swap(other);
+        checkSame(other, {});
+        checkSame(empty, letters);
+        other.push_back("again");
+        checkSame(other, {"again"});
+    }
+
+    SECTION("clear") {
+        list.clear();
+        checkSame(list, {});
+        list.insert_at(0, "b");
+        list.insert_at(0, "a");
+        list.insert_at(2, "c");
+        checkSame(list, {"a", "b", "c"});
+    }
+}
+
+// EOF: IndexedLList-test.cxx
@@ -0,0 +1,582 @@
+/// @file IndexedLList.hpp
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This header file contains the class "IndexedLList", an LList with
+/// an order-statistic skip index on top. The elements stay in an LList; a
+/// quarter of its nodes also get a tower of express links, as in an
+/// indexable skip list, each link knowing how many elements it skips. The
+/// element at position k is then reached in expected O(log n) steps instead
+/// of k, and so are insert_at(k, value) and erase_at(k). The iterators are
+/// LList's, and insert and erase at an iterator keep the index up to date.
+///
+/// Example usage:
+/// @code
+///   IndexedLList<char> text = {'a', 'c'};
+///   text.insert_at(1, 'b');                    // a b c
+///   auto it = text.advance(2);                 // 'c', in O(log n)
+///   text.insert(it, 'x');                      // a b x c
+///   text.erase_at(0);                          // b x c
+///   std::size_t k = text.index_of(it);         // 2
+/// @endcode
+
+// Definitions
+#ifndef INDEXED_LLIST_HPP
+#define INDEXED_LLIST_HPP
+
+// Preprocessor Directive(s)
+#include <cstddef>  // provides std::size_t
+#include <cstdint>  // provides std::uint32_t
+#include <initializer_list>
+#include <memory>   // provides std::unique_ptr
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>  // provides std::forward, std::move and std::swap
+
+#include "LList.hpp"
+
+/* ========================================================================== */
+/* ========== Class/Struct Definition(s) ========= */
+/* ========================================================================== */
+/// IndexedLList is an LList whose elements can also be reached by position
+/// in expected O(log n). The skip index has MAX_LEVEL express levels above
+/// the list itself. A node gets a tower of height h (links on levels 1 to h)
+/// with probability 4^-h; a head tower of full height stands before the
+/// first element. Each link stores its width, the number of positions it
+/// spans, so a search adds up widths instead of counting nodes.
+///
+/// The towers are found from their nodes through a hash table. insert and
+/// erase at an iterator walk back from the node to the nearest tower, then
+/// up the levels, to find the links that span the position: also expected
+/// O(log n). The list itself must not be changed other than through the
+/// IndexedLList.
+///
+/// @tparam T Type of the elements.
+template <class T>
+class IndexedLList {
+public:
+    /// Express levels of the index, enough for 4^16 elements.
+    static const std::size_t MAX_LEVEL = 16;
+
+    // types
+    using value_type = T;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = typename LList<T>::iterator;
+    using const_iterator = typename LList<T>::const_iterator;
+
+    // construct/copy/destroy
+    IndexedLList();
+    IndexedLList(const IndexedLList& other);
+    IndexedLList(IndexedLList&& other) noexcept;
+    IndexedLList(std::initializer_list<T> ilist);
+    virtual ~IndexedLList();
+
+    // assignment
+    IndexedLList& operator=(const IndexedLList& other);
+    IndexedLList& operator=(IndexedLList&& other) noexcept;
+    IndexedLList& operator=(std::initializer_list<T> ilist);
+
+    // iterators
+    /// Returns an iterator pointing to the first element / past the last.
+    iterator       begin() noexcept { return list.begin(); }
+    const_iterator begin() const noexcept { return list.begin(); }
+    iterator       end() noexcept { return list.end(); }
+    const_iterator end() const noexcept { return list.end(); }
+
+    // capacity
+    /// Returns true if the list is empty, otherwise false, and the number of
+    /// elements in the list.
+    bool empty() const noexcept { return list.empty(); }
+    size_type size() const noexcept { return list.size(); }
+
+    // element access
+    /// Returns a reference to the first / last element in the list.
+    reference       front() { return list.front(); }
+    const_reference front() const { return list.front(); }
+    reference       back() { return list.back(); }
+    const_reference back() const { return list.back(); }
+
+    // positions
+    iterator  advance(size_type k) const;
+    size_type index_of(const_iterator position) const;
+
+    // modifiers
+    void     push_front(const T& value);
+    void     pop_front();
+    void     push_back(const T& value);
+    void     pop_back();
+    iterator insert(const_iterator position, const T& value);
+    iterator insert(const_iterator position, T&& value);
+    iterator insert_at(size_type k, const T& value);
+    iterator erase(const_iterator position);
+    iterator erase_at(size_type k);
+
+    template <class... Args>
+    iterator emplace(const_iterator position, Args&&... args);
+    void     swap(IndexedLList& other) noexcept;
+    void     clear() noexcept;
+
+private:
+    struct SkipTower;
+
+    /// SkipLink is the link of a tower on one express level.
+    struct SkipLink {
+        SkipTower* prev;   ///< Previous tower on the level
+        SkipTower* next;   ///< Next tower on the level, or nullptr
+        size_type  width;  ///< Positions to next, or to past the last
+    };
+
+    /// SkipTower holds the express links of one node, levels 1 to height.
+    struct SkipTower {
+        Node<T>*                    node;    ///< The node; nullptr for head
+        size_type                   height;  ///< Number of express levels
+        std::unique_ptr<SkipLink[]> links;   ///< links[i] is level i + 1
+    };
+
+    size_type locate(Node<T>* node, SkipTower** preds,
+                     size_type* dist) const;
+    size_type randomHeight() noexcept;
+    void      resetHead() noexcept;
+    void      adoptHead(IndexedLList& other) noexcept;
+
+    LList<T>  list;        ///< The elements
+    SkipTower head;        ///< Tower before the first element, full height
+    Node<T>*  last;        ///< Last node of list, which LList does not expose
+    std::unordered_map<const Node<T>*, SkipTower*> towers;  ///< Node's tower
+    std::uint32_t random;  ///< State of the height generator
+};  // End: class IndexedLList
+
+
+/* ========================================================================== */
+/* ========== Function Implementations ========== */
+/* ========================================================================== */
+
+/* ========== Constructor/Copy/Destructor: All ========== */
+/// Constructor: IndexedLList
+/// Initializes an empty list with the head tower only.
+template <class T>
+IndexedLList<T>::IndexedLList()
+    : head{nullptr, MAX_LEVEL, std::unique_ptr<SkipLink[]>(
+                                   new SkipLink[MAX_LEVEL])},
+      last(nullptr), random(2463534242U) {
+    resetHead();
+}
+
+/// Copy: IndexedLList
+/// Initializes a new list by appending copies of the elements of other,
+/// building a fresh index.
+template <class T>
+IndexedLList<T>::IndexedLList(const IndexedLList& other) : IndexedLList() {
+    for (const T& item : other) {
+        this->push_back(item);
+    }
+}
+
+/// Move: IndexedLList
+/// Takes over the list and the index of other, leaving other empty.
+template <class T>
+IndexedLList<T>::IndexedLList(IndexedLList&& other) noexcept
+    : IndexedLList() {
+    this->swap(other);
+}
+
+/// Constructor: IndexedLList std::initializer_list<T>
+/// Initializes the list with the elements of ilist, in order.
+template <class T>
+IndexedLList<T>::IndexedLList(std::initializer_list<T> ilist)
+    : IndexedLList() {
+    for (const T& item : ilist) {
+        this->push_back(item);
+    }
+}
+
+/// Destructor: IndexedLList
+/// Deletes the towers; the list destroys the elements.
+template <class T>
+IndexedLList<T>::~IndexedLList() {
+    this->clear();
+}
+
+/* ========== Assignment: IndexedLList ========== */
+/// Operator=(const IndexedLList& other): IndexedLList
+/// Copy assignment operator. Clears the list, then copies other into it.
+template <class T>
+IndexedLList<T>& IndexedLList<T>::operator=(const IndexedLList& other) {
+    if (this != &other) {
+        this->clear();
+        for (const T& item : other) {
+            this->push_back(item);
+        }
+    }
+
+    return *this;
+}
+
+/// Operator=(IndexedLList&& other): IndexedLList
+/// Move assignment operator. Clears the list, then takes over other's.
+template <class T>
+IndexedLList<T>& IndexedLList<T>::operator=(IndexedLList&& other) noexcept {
+    if (this != &other) {
+        this->clear();
+        this->swap(other);
+    }
+
+    return *this;
+}
+
+/// Operator=(std::initializer_list<T> ilist): IndexedLList
+/// Clears the list, then appends each element of ilist.
+template <class T>
+IndexedLList<T>& IndexedLList<T>::operator=(std::initializer_list<T> ilist) {
+    this->clear();
+    for (const T& item : ilist) {
+        this->push_back(item);
+    }
+
+    return *this;
+}
+
+/* ========== Positions: IndexedLList ========== */
+/// Iterator advance(size_type k) const: IndexedLList
+/// Returns an iterator pointing to the element at position k (from 0), or
+/// end() for k == size(), in expected O(log n): the search takes the
+/// widest links that do not pass position k, level by level, then walks
+/// the few nodes left on the list.
+template <class T>
+typename IndexedLList<T>::iterator
+         IndexedLList<T>::advance(size_type k) const {
+    if (k > list.size()) {
+        throw std::out_of_range("Out of Range!");
+    }
+    if (k == list.size()) {
+        return iterator(nullptr);
+    }
+
+    // Positions count from 1 here; the head tower is at position 0
+    const size_type  target = k + 1;
+    size_type        position = 0;
+    const SkipTower* tower = &head;
+
+    for (size_type i = MAX_LEVEL; i-- > 0;) {
+        while (tower->links[i].next != nullptr &&
+               position + tower->links[i].width <= target) {
+            position += tower->links[i].width;
+            tower = tower->links[i].next;
+        }
+    }
+
+    Node<T>* node = tower->node;
+    if (node == nullptr) {
+        node = list.begin().current;
+        position = 1;
+    }
+    for (; position < target; ++position) {
+        node = node->next;
+    }
+
+    return iterator(node);
+}
+
+/// Size_type index_of(const_iterator position) const: IndexedLList
+/// Returns the position (from 0) of the element at position, or size() for
+/// end(), in expected O(log n).
+template <class T>
+typename IndexedLList<T>::size_type
+         IndexedLList<T>::index_of(const_iterator position) const {
+    SkipTower* preds[MAX_LEVEL];
+    size_type  dist[MAX_LEVEL];
+
+    return locate(position.current, preds, dist) - 1;
+}
+
+/* ========== Modifiers: IndexedLList ========== */
+/// Void push_front(const T& value): IndexedLList
+/// Adds a copy of value at the front of the list.
+template <class T>
+void IndexedLList<T>::push_front(const T& value) {
+    emplace(begin(), value);
+}
+
+/// Void pop_front(): IndexedLList
+/// Removes the first element of the list, if any.
+template <class T>
+void IndexedLList<T>::pop_front() {
+    if (!list.empty()) {
+        erase(begin());
+    }
+}
+
+/// Void push_back(const T& value): IndexedLList
+/// Adds a copy of value at the end of the list.
+template <class T>
+void IndexedLList<T>::push_back(const T& value) {
+    emplace(end(), value);
+}
+
+/// Void pop_back(): IndexedLList
+/// Removes the last element of the list, if any.
+template <class T>
+void IndexedLList<T>::pop_back() {
+    if (last != nullptr) {
+        erase(iterator(last));
+    }
+}
+
+/// Iterator insert(const_iterator position, const T& value): IndexedLList
+/// Inserts a copy of value before position in expected O(log n).
+/// Returns an iterator pointing to the new element.
+template <class T>
+typename IndexedLList<T>::iterator
+         IndexedLList<T>::insert(const_iterator position, const T& value) {
+    return emplace(position, value);
+}
+
+/// Iterator insert(const_iterator position, T&& value): IndexedLList
+/// Inserts value before position, moving it into the node.
+/// Returns an iterator pointing to the new element.
+template <class T>
+typename IndexedLList<T>::iterator
+         IndexedLList<T>::insert(const_iterator position, T&& value) {
+    return emplace(position, std::move(value));
+}
+
+/// Iterator insert_at(size_type k, const T& value): IndexedLList
+/// Inserts a copy of value at position k (from 0), before the element now
+/// there, in expected O(log n).
+/// Returns an iterator pointing to the new element.
+template <class T>
+typename IndexedLList<T>::iterator
+         IndexedLList<T>::insert_at(size_type k, const T& value) {
+    return emplace(advance(k), value);
+}
+
+/// Iterator erase(const_iterator position): IndexedLList
+/// Removes the element at position in expected O(log n): the links that
+/// spanned it lose a position, and the links of its tower, if any, are
+/// joined into those of the towers before it.
+/// Returns the iterator following the removed element.
+template <class T>
+typename IndexedLList<T>::iterator
+         IndexedLList<T>::erase(const_iterator position) {
+    Node<T>* node = position.current;
+
+    // Verify position designates an element
+    if (node == nullptr) {
+        throw std::invalid_argument("Out of Range!");
+    }
+
+    SkipTower* preds[MAX_LEVEL];
+    size_type  dist[MAX_LEVEL];
+    locate(node, preds, dist);
+
+    const auto found = towers.find(node);
+    SkipTower* tower = found != towers.end() ? found->second : nullptr;
+
+    for (size_type i = 0; i < MAX_LEVEL; ++i) {
+        SkipLink& link = preds[i]->links[i];
+
+        if (tower != nullptr && i < tower->height) {
+            link.width += tower->links[i].width - 1;
+            link.next = tower->links[i].next;
+            if (link.next != nullptr) {
+                link.next->links[i].prev = preds[i];
+            }
+        } else {
+            --link.width;
+        }
+    }
+
+    if (tower != nullptr) {
+        towers.erase(found);
+        delete tower;
+    }
+    if (node == last) {
+        last = node->prev;
+    }
+
+    return list.erase(position);
+}
+
+/// Iterator erase_at(size_type k): IndexedLList
+/// Removes the element at position k (from 0) in expected O(log n).
+/// Returns the iterator following the removed element.
+template <class T>
+typename IndexedLList<T>::iterator IndexedLList<T>::erase_at(size_type k) {
+    if (k >= list.size()) {
+        throw std::out_of_range("Out of Range!");
+    }
+
+    return erase(advance(k));
+}
+
+/// Iterator emplace(const_iterator position, Args&&... args): IndexedLList
+/// Constructs an element from args before position in expected O(log n).
+/// The links that span the new position gain one; if the new node draws a
+/// tower, each of its levels splits the spanning link in two.
+/// Returns an iterator pointing to the new element.
+template <class T>
+template <class... Args>
+typename IndexedLList<T>::iterator
+         IndexedLList<T>::emplace(const_iterator position, Args&&... args) {
+    SkipTower* preds[MAX_LEVEL];
+    size_type  dist[MAX_LEVEL];
+    locate(position.current, preds, dist);
+
+    iterator  added = list.emplace(position, std::forward<Args>(args)...);
+    size_type height = randomHeight();
+
+    SkipTower* tower = nullptr;
+    if (height > 0) {
+        try {
+            tower = new SkipTower{added.current, height,
+                                  std::unique_ptr<SkipLink[]>(
+                                      new SkipLink[height])};
+            towers.emplace(added.current, tower);
+        } catch (...) {
+            delete tower;
+            list.erase(added);
+            throw;
+        }
+    }
+
+    for (size_type i = 0; i < MAX_LEVEL; ++i) {
+        SkipLink& link = preds[i]->links[i];
+
+        if (i < height) {
+            tower->links[i].prev = preds[i];
+            tower->links[i].next = link.next;
+            tower->links[i].width = link.width - dist[i] + 1;
+            if (link.next != nullptr) {
+                link.next->links[i].prev = tower;
+            }
+
+            link.next = tower;
+            link.width = dist[i];
+        } else {
+            ++link.width;
+        }
+    }
+
+    if (position.current == nullptr) {
+        last = added.current;
+    }
+
+    return added;
+}
+
+/// Void swap(IndexedLList& other) noexcept: IndexedLList
+/// Swaps the elements and the indexes of the list and other.
+template <class T>
+void IndexedLList<T>::swap(IndexedLList& other) noexcept {
+    list.swap(other.list);
+    towers.swap(other.towers);
+    std::swap(last, other.last);
+    std::swap(random, other.random);
+
+    for (size_type i = 0; i < MAX_LEVEL; ++i) {
+        std::swap(head.links[i], other.head.links[i]);
+    }
+    adoptHead(*this);
+    adoptHead(other);
+}
+
+/// Void clear() noexcept: IndexedLList
+/// Removes all elements and their towers.
+template <class T>
+void IndexedLList<T>::clear() noexcept {
+    for (auto& entry : towers) {
+        delete entry.second;
+    }
+    towers.clear();
+    list.clear();
+    last = nullptr;
+
+    resetHead();
+}
+
+/* ========== Private Helpers: IndexedLList ========== */
+/// Size_type locate(Node<T>* node, SkipTower** preds, size_type* dist)
+/// const: IndexedLList
+/// Finds, on every express level i, the last tower preds[i] before node
+/// (or past the last element if node is nullptr) and the distance dist[i]
+/// from it to node. The search walks back on the list to the nearest node
+/// with a tower, then back on each level to the nearest taller tower, until
+/// it reaches the head.
+/// Returns the position of node, from 1.
+template <class T>
+typename IndexedLList<T>::size_type
+         IndexedLList<T>::locate(Node<T>* node, SkipTower** preds,
+                                 size_type* dist) const {
+    Node<T>*   walk = node != nullptr ? node->prev : last;
+    size_type  distance = 1;
+    SkipTower* tower = const_cast<SkipTower*>(&head);
+
+    for (; walk != nullptr; walk = walk->prev, ++distance) {
+        const auto found = towers.find(walk);
+        if (found != towers.end()) {
+            tower = found->second;
+            break;
+        }
+    }
+
+    for (size_type i = 0; i < MAX_LEVEL; ++i) {
+        while (tower->height <= i) {
+            tower = tower->links[i - 1].prev;
+            distance += tower->links[i - 1].width;
+        }
+
+        preds[i] = tower;
+        dist[i] = distance;
+    }
+
+    // The head is the only tower of full height, at position 0
+    return distance;
+}
+
+/// Size_type randomHeight() noexcept: IndexedLList
+/// Returns the height of the tower of a new node: h with probability
+/// 3 / 4^(h + 1), so that 0 (no tower) is the most likely.
+template <class T>
+typename IndexedLList<T>::size_type IndexedLList<T>::randomHeight() noexcept {
+    // xorshift32
+    random ^= random << 13;
+    random ^= random >> 17;
+    random ^= random << 5;
+
+    size_type     height = 0;
+    std::uint32_t bits = random;
+    while ((bits & 3) == 0 && height < MAX_LEVEL - 1) {
+        ++height;
+        bits = (bits >> 2) | 0x80000000U;   // stops after 15 levels at most
+    }
+
+    return height;
+}
+
+/// Void resetHead() noexcept: IndexedLList
+/// Unlinks the head tower on every level; each link then spans the list.
+template <class T>
+void IndexedLList<T>::resetHead() noexcept {
+    for (size_type i = 0; i < MAX_LEVEL; ++i) {
+        head.links[i] = SkipLink{nullptr, nullptr, list.size() + 1};
+    }
+}
+
+/// Void adoptHead(IndexedLList& other) noexcept: IndexedLList
+/// Points the first tower of every level of other back at other's head,
+/// after the head links were exchanged.
+template <class T>
+void IndexedLList<T>::adoptHead(IndexedLList& other) noexcept {
+    for (size_type i = 0; i < MAX_LEVEL; ++i) {
+        if (other.head.links[i].next != nullptr) {
+            other.head.links[i].next->links[i].prev = &other.head;
+        }
+    }
+}
+
+#endif  // INDEXED_LLIST_HPP
+
+// EOF: IndexedLList.hpp
@@ -12,13 +12,19 @@
 ///
 /// @note subject to change -- create a symbolic link to the source document.
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
 #include <string>
+#include <utility>
 
 #define CATCH_CONFIG_MAIN
 #include <catch.hpp>
 
 #include "LList.hpp"
 #include "LList.hpp"  // test include guard
+#include "ParallelSort.hpp"
 
 TEMPLATE_TEST_CASE("Node struct is correctly initialized", "[Node]",
                    int, double, std::string) {
@@ -465,4 +471,288 @@ TEST_CASE("LList modifier operations", "[LList]") {
     }
 }
 
+TEST_CASE("LList move and emplace operations", "[LList]") {
+    SECTION("rvalue push and insert move the value into the node") {
+        LList<std::string> list;
+        std::string first(40, 'a');
+        std::string second(40, 'b');
+        std::string third(40, 'c');
+
+        list.push_back(std::move(first));
+        list.push_front(std::move(second));
+        list.insert(list.end(), std::move(third));
+        CHECK(list.size() == 3);
+        CHECK(list.front() == std::string(40, 'b'));
+        CHECK(list.back() == std::string(40, 'c'));
+    }
+
+    SECTION("emplace constructs the element in place") {
+        LList<std::string> list;
+        CHECK(list.emplace_back(3, 'x') == "xxx");
+        CHECK(list.emplace_front(2, 'y') == "yy");
+
+        auto it = list.emplace(std::next(list.begin()), "z");
+        CHECK(*it == "z");
+        CHECK(list.size() == 3);
+        CHECK(list.front() == "yy");
+        CHECK(list.back() == "xxx");
+    }
+}
+
+TEST_CASE("LList splice and merge operations", "[LList]") {
+    SECTION("splice a whole list") {
+        LList<int> list1 = {1, 4};
+        LList<int> list2 = {2, 3};
+        auto moved = list2.begin();
+
+        list1.splice(std::next(list1.begin()), list2);
+        CHECK(list1.size() == 4);
+        CHECK(list2.empty());
+        CHECK(list2.size() == 0);
+        CHECK(*moved == 2);     // iterators stay valid
+        int expected = 1;
+        for (int value : list1) {
+            CHECK(value == expected++);
+        }
+
+        list1.splice(list1.end(), list2);   // empty list is a no-op
+        CHECK(list1.size() == 4);
+        CHECK(list1.back() == 4);
+    }
+
+    SECTION("splice a range from another list and within a list") {
+        LList<std::string> list1 = {"a", "e"};
+        LList<std::string> list2 = {"x", "b", "c", "d", "y"};
+
+        list1.splice(std::next(list1.begin()), list2,
+                     std::next(list2.begin()), std::next(list2.begin(), 4));
+        CHECK(list1.size() == 5);
+        CHECK(list2.size() == 2);
+        CHECK(list2.front() == "x");
+        CHECK(list2.back() == "y");
+
+        list1.splice(list1.end(), list1, list1.begin(),
+                     std::next(list1.begin()));
+        CHECK(list1.size() == 5);
+        CHECK(list1.front() == "b");
+        CHECK(list1.back() == "a");
+
+        list2.push_back("z");
+        list1.push_front("w");
+        CHECK(list2.back() == "z");
+        CHECK(list1.front() == "w");
+    }
+
+    SECTION("spliced nodes outlive the list they came from") {
+        LList<std::string> list1 = {"a", "b"};
+        std::string* moved = nullptr;
+        {
+            LList<std::string> list2 = {"x", "y", "z"};
+            moved = &*std::next(list2.begin());
+
+            // Each list keeps its own pool; the node is relinked as is
+            list1.splice(list1.end(), list2, std::next(list2.begin()),
+                         std::next(list2.begin(), 2));
+            CHECK(&list1.back() == moved);
+            list2.pop_front();
+            list2.push_back("w");
+        }
+        CHECK(list1.back() == "y");
+        CHECK(&list1.back() == moved);
+
+        // The node moves on to a third list, which frees it last
+        LList<std::string> list3 = {"q"};
+        list3.splice(list3.begin(), list1, std::next(list1.begin(), 2),
+                     list1.end());
+        list1.clear();
+        list1.push_back("c");
+        CHECK(list3.front() == "y");
+        CHECK(list3.size() == 2);
+        list3.pop_front();
+        list3.push_front("r");
+        CHECK(list3.front() == "r");
+    }
+
+    SECTION("whole lists spliced and merged across pools") {
+        LList<int> list1 = {1, 4};
+        for (int round = 0; round < 3; ++round) {
+            LList<int> list2;
+            for (int i = 0; i < 1000; ++i) {
+                list2.push_back(10 + i);
+            }
+            LList<int> list3 = {2, 3};
+
+            list1.merge(list3);
+            list1.splice(list1.end(), list2);
+            CHECK(list2.empty());
+            CHECK(list3.empty());
+
+            list2.push_back(7);
+            list1.splice(list1.begin(), list2);
+            list1.pop_front();
+            for (int i = 0; i < 4; ++i) {
+                list1.pop_back();
+            }
+        }
+        CHECK(list1.size() == 2 + 3 * 998);
+        CHECK(list1.front() == 1);
+        CHECK(*std::next(list1.begin(), 3) == 2);
+        CHECK(*std::next(list1.begin(), 4) == 3);
+    }
+
+    SECTION("merge two sorted lists") {
+        LList<int> list1 = {1, 3, 5};
+        LList<int> list2 = {2, 3, 6, 7};
+
+        list1.merge(list2);
+        CHECK(list1.size() == 7);
+        CHECK(list2.empty());
+        CHECK(list1.front() == 1);
+        CHECK(list1.back() == 7);
+
+        LList<int> list3 = {9, 4};
+        LList<int> list4 = {8, 4, 1};
+        list3.merge(list4, [](int a, int b) { return a > b; });
+        CHECK(list3.size() == 5);
+        CHECK(list3.front() == 9);
+        CHECK(list3.back() == 1);
+    }
+}
+
+TEST_CASE("LList sort operation", "[LList]") {
+    SECTION("sort relinks the nodes in order") {
+        LList<int> list = {5, 3, 9, 1, 3, 7};
+        int& nine = *std::next(list.begin(), 2);
+
+        list.sort();
+        CHECK(list.size() == 6);
+        CHECK(list.front() == 1);
+        CHECK(list.back() == 9);
+        CHECK(&nine == &list.back());
+        CHECK(std::is_sorted(list.begin(), list.end()));
+
+        list.pop_back();
+        list.push_front(8);
+        CHECK(list.front() == 8);
+        CHECK(list.back() == 7);
+    }
+
+    SECTION("sort is stable") {
+        LList<std::string> list = {"bb", "a", "cc", "d", "ee", "f"};
+
+        list.sort([](const std::string& a, const std::string& b) {
+            return a.size() < b.size();
+        });
+        CHECK(list.front() == "a");
+        CHECK(*std::next(list.begin()) == "d");
+        CHECK(*std::next(list.begin(), 3) == "bb");
+        CHECK(list.back() == "ee");
+    }
+}
+
+TEST_CASE("LList parallel sort", "[LList]") {
+    // Keys that repeat, each tagged with its position: sorted pairs mean the
+    // keys are in order and equal keys kept their order
+    using Element = std::pair<int, int>;
+    const int size = static_cast<int>(PARALLEL_SORT_MIN) * 2 + 3;
+    LList<Element> list;
+    for (int i = 0; i < size; ++i) {
+        list.push_back({i * 7919 % 1000, i});
+    }
+    auto byKey = [](const Element& a, const Element& b) {
+        return a.first < b.first;
+    };
+
+    SECTION("a long list is sorted stably on several threads") {
+        for (unsigned threads : {2u, 3u, 8u}) {
+            LList<Element> copy(list);
+            const Element* first = &copy.front();
+
+            parallelSort(copy, byKey, threads);
+            CHECK(copy.size() == static_cast<std::size_t>(size));
+            CHECK(std::is_sorted(copy.begin(), copy.end()));
+            CHECK(&copy.front() == first);
+        }
+    }
+
+    SECTION("a short list is sorted on the calling thread") {
+        LList<Element> shortList = {{2, 0}, {1, 1}, {2, 2}, {1, 3}};
+        parallelSort(shortList, byKey, 4);
+        CHECK(std::is_sorted(shortList.begin(), shortList.end()));
+    }
+
+    SECTION("a throwing comparison keeps every element") {
+        std::atomic<int> calls{0};
+        auto throwing = [&](const Element& a, const Element& b) {
+            if (++calls == size) {
+                throw std::runtime_error("comparison failed");
+            }
+            return a.first < b.first;
+        };
+
+        CHECK_THROWS_AS(parallelSort(list, throwing, 4), std::runtime_error);
+        CHECK(list.size() == static_cast<std::size_t>(size));
+
+        std::size_t nodes = 0;
+        long long   positions = 0;
+        for (const Element& element : list) {
+            ++nodes;
+            positions += element.second;
+        }
+        CHECK(nodes == static_cast<std::size_t>(size));
+        CHECK(positions == static_cast<long long>(size) * (size - 1) / 2);
+    }
+}
+
+TEST_CASE("LList bulk copy", "[LList]") {
+    SECTION("a copy lays its nodes out in list order") {
+        LList<int> original;
+        for (int i = 0; i < 100; ++i) {
+            original.push_front(i);
+        }
+
+        LList<int> copy(original);
+        LList<int> assigned = {1, 2, 3};
+        assigned = copy;
+
+        for (LList<int>* list : {&copy, &assigned}) {
+            CHECK(std::equal(list->begin(), list->end(), original.begin(),
+                             original.end()));
+            for (auto it = list->begin(); std::next(it) != list->end();
+                 ++it) {
+                // Adjacent, or at the start of the next page of the slab
+                const std::uintptr_t node =
+                    reinterpret_cast<std::uintptr_t>(&*it);
+                const std::uintptr_t next =
+                    reinterpret_cast<std::uintptr_t>(&*std::next(it));
+                const std::uintptr_t page = NodePool<Node<int>>::PAGE;
+                CHECK((next - node == sizeof(Node<int>) ||
+                       next / page == node / page + 1));
+            }
+        }
+    }
+
+    SECTION("a copy that throws leaves no elements behind") {
+        struct Fragile {
+            int value;
+            Fragile(int v) : value(v) {}
+            Fragile(const Fragile& other) : value(other.value) {
+                if (value == 3) {
+                    throw std::runtime_error("copy failed");
+                }
+            }
+        };
+
+        LList<Fragile> original = {Fragile(1)};
+        original.emplace_back(2);
+        original.emplace_back(3);
+        CHECK_THROWS_AS(LList<Fragile>(original), std::runtime_error);
+
+        LList<Fragile> assigned;
+        assigned.emplace_back(7);
+        CHECK_THROWS_AS(assigned = original, std::runtime_error);
+        CHECK(assigned.empty());
+    }
+}
+
 /* EOF */
@@ -22,8 +22,15 @@
 #define LLIST_HPP
 
 // Preprocessor Directive(s)
+#include <atomic>
+#include <cstddef>  // provides std::size_t
+#include <cstdint>  // provides std::uintptr_t
+#include <functional>  // provides std::less
 #include <initializer_list>
 #include <iterator>
+#include <new>      // provides placement new
+#include <type_traits>
+#include <utility>  // provides std::forward, std::in_place and std::swap
 
 /* ========================================================================== */
 /* ========== Class/Struct Definition(s) ========= */
@@ -51,12 +58,155 @@ struct Node {
          Node* next_node = nullptr)
          : data(value), prev(prev_node), next(next_node) {};
 
+    /// Constructor: Node
+    /// Initializes the node by moving value into it, linked like above.
+    explicit Node(value_type&& value, Node* prev_node = nullptr,
+         Node* next_node = nullptr)
+         : data(std::move(value)), prev(prev_node), next(next_node) {};
+
+    /// Constructor: Node
+    /// Initializes the data in place from args, with no links (emplace).
+    template <class... Args>
+    explicit Node(std::in_place_t, Args&&... args)
+         : data(std::forward<Args>(args)...), prev(nullptr), next(nullptr) {};
+
     value_type  data;         ///< Data of the node, of type T
     Node*       prev;         ///< Pointer to the previous node
     Node*       next;         ///< Pointer to the next node
 };  // End: struct Node
 
 
+/// Returns the smallest power of 2 of at least n.
+constexpr std::size_t roundUpPow2(std::size_t n) {
+    std::size_t pow = 1;
+    while (pow < n) {
+        pow *= 2;
+    }
+    return pow;
+}
+
+/// NodePool hands out the storage of list nodes from slabs, blocks of many
+/// nodes allocated at once, so that a list calls the allocator once per slab
+/// instead of once per element. Freed nodes are kept on a free list and
+/// reused before the slabs are touched again, so a list that pushes and pops
+/// in steady state does not allocate at all.
+///
+/// A slab is made of pages of PAGE bytes, aligned to PAGE, and each page
+/// starts with a header pointing at the slab, so the slab of any node is
+/// found by rounding its address down. The slab counts the slots it still
+/// holds for its pools. Nodes may thus move from one list to another (splice,
+/// merge): share() marks both pools, and a node is given back to its slab by
+/// whichever pool holds it when that pool is released. The last slot given
+/// back frees the slab, even from another thread, as the count is atomic.
+/// Pools that never exchanged nodes skip the counting and free their slabs
+/// at once.
+///
+/// The pool only manages raw storage: allocate() returns memory for one
+/// NodeType to be constructed with placement new, and deallocate() takes it
+/// back after the node was destroyed.
+///
+/// Example usage:
+/// @code
+///   NodePool<Node<int>> pool;
+///   Node<int>* node = ::new (pool.allocate()) Node<int>(42);
+///   node->~Node();
+///   pool.deallocate(node);
+/// @endcode
+template <class NodeType>
+class NodePool {
+    /// Slot is the storage of one node, or the link of a free slot.
+    union Slot {
+        Slot* next;                                      ///< Next free slot
+        alignas(NodeType) unsigned char node[sizeof(NodeType)];  ///< Node
+    };
+
+    struct SlabHeader;
+
+    /// PageHeader starts every page of a slab.
+    struct PageHeader {
+        SlabHeader* slab;  ///< The slab of the page
+    };
+
+    /// SlabHeader starts the first page of a slab, in place of its
+    /// PageHeader.
+    struct SlabHeader {
+        PageHeader               page;   ///< Points back at the slab itself
+        std::atomic<std::size_t> held;   ///< Slots not given back yet
+        SlabHeader*              next;   ///< Next slab of a pool that has
+                                         ///< not exchanged nodes
+        void*                    block;  ///< Allocation aligned by hand,
+                                         ///< or nullptr
+    };
+
+    /// Bytes before the first slot of a page.
+    static constexpr std::size_t HEADER =
+        (sizeof(SlabHeader) + alignof(Slot) - 1) / alignof(Slot) *
+        alignof(Slot);
+
+public:
+    /// Bytes of a page: a power of 2 with room for at least 16 nodes.
+    static constexpr std::size_t PAGE =
+        roundUpPow2(HEADER + 16 * sizeof(Slot)) < 512
+            ? 512 : roundUpPow2(HEADER + 16 * sizeof(Slot));
+    /// Nodes in a page.
+    static constexpr std::size_t PAGE_NODES = (PAGE - HEADER) / sizeof(Slot);
+    /// Most pages in one slab grown by allocate(), about 4096 nodes; the
+    /// first slab has one page and each further one doubles.
+    static constexpr std::size_t MAX_PAGES =
+        roundUpPow2((4096 + PAGE_NODES - 1) / PAGE_NODES);
+    /// Bytes from which a slab is aligned by hand rather than by operator
+    /// new: glibc maps large aligned blocks afresh each time, faulting in
+    /// every page again, while a plain block is reused once freed.
+    static constexpr std::size_t LARGE_SLAB = 64 * 1024;
+
+    NodePool() noexcept
+        : m_free(nullptr), m_slabs(nullptr), m_current(nullptr),
+          m_page(nullptr), m_next(nullptr), m_pageEnd(nullptr),
+          m_slabEnd(nullptr), m_slabPages(1), m_exchanged(false) {}
+    NodePool(const NodePool&) = delete;
+    NodePool(NodePool&& other) noexcept;
+    ~NodePool() { release(); }
+
+    NodePool& operator=(const NodePool&) = delete;
+    NodePool& operator=(NodePool&& other) noexcept;
+
+    NodeType* allocate();
+    void      deallocate(NodeType* node) noexcept;
+    void      reserve(std::size_t nodes);
+    void      release() noexcept;
+    void      share(NodePool& other) noexcept;
+    void      swap(NodePool& other) noexcept;
+
+    /// Returns true if nodes moved between this pool and another since it
+    /// was last released.
+    bool exchanged() const noexcept { return m_exchanged; }
+
+private:
+    void        grow(std::size_t pages);
+    std::size_t unused() const noexcept;
+    void        dropUnused() noexcept;
+    static void drop(SlabHeader* slab, std::size_t slots) noexcept;
+    static void freeSlab(SlabHeader* slab) noexcept;
+
+    /// Returns the slab the slot lies in.
+    static SlabHeader* slabOf(const Slot* slot) noexcept {
+        const std::uintptr_t page =
+            reinterpret_cast<std::uintptr_t>(slot) & ~(PAGE - 1);
+        return reinterpret_cast<const PageHeader*>(page)->slab;
+    }
+
+    Slot*          m_free;       ///< Free list of deallocated slots
+    SlabHeader*    m_slabs;      ///< Slabs, unless nodes were exchanged
+    SlabHeader*    m_current;    ///< Slab of the unused slots, if any
+    unsigned char* m_page;       ///< Page of the unused slots
+    unsigned char* m_next;       ///< Next unused slot of the page
+    unsigned char* m_pageEnd;    ///< End of the slots of the page
+    unsigned char* m_slabEnd;    ///< End of the slab
+    std::size_t    m_slabPages;  ///< Pages in the next slab
+    bool           m_exchanged;  ///< Nodes moved to or from another pool
+};  // End: class NodePool
+
+
 /// List is a container that supports constant time insertion and removal of
 /// elements from anywhere in the container. Fast random access is not
 /// supported. It is implemented as a doubly-linked list. This container
@@ -132,13 +282,13 @@ public:
     /// Sets head and tail pointers to nullptr and count to 0.
     LList() : head(nullptr), tail(nullptr), count(0) {};
     LList(const LList& other);
-    LList(LList&& other);
+    LList(LList&& other) noexcept;
     LList(std::initializer_list<T> ilist);
     virtual ~LList();
 
     // assignment
     LList& operator=(const LList& other);
-    LList& operator=(LList&& other);
+    LList& operator=(LList&& other) noexcept;
     LList& operator=(std::initializer_list<T> ilist);
 
     // iterators
@@ -165,18 +315,60 @@ public:
 
     // modifiers
     void     push_front(const T& value);
+    void     push_front(T&& value);
     void     pop_front();
     void     push_back(const T& value);
+    void     push_back(T&& value);
     void     pop_back();
     iterator insert(const_iterator position, const T& value);
+    iterator insert(const_iterator position, T&& value);
     iterator erase(const_iterator position);
+
+    template <class... Args>
+    reference emplace_front(Args&&... args);
+    template <class... Args>
+    reference emplace_back(Args&&... args);
+    template <class... Args>
+    iterator  emplace(const_iterator position, Args&&... args);
     void     swap(LList& other);
     void     clear() noexcept;
 
+    // operations
+    void splice(const_iterator position, LList& other);
+    void splice(const_iterator position, LList& other, const_iterator first,
+                const_iterator last);
+    template <class Compare = std::less<T>>
+    void merge(LList& other, Compare cmp = Compare());
+    template <class Compare = std::less<T>>
+    void sort(Compare cmp = Compare());
+
 private:
+    template <class... Args>
+    Node<T>* createNode(Args&&... args);
+    void     destroyNode(Node<T>* node) noexcept;
+    template <class InputIt>
+    void     appendCopies(InputIt first, InputIt last, size_type n);
+    void     linkChain(Node<T>* position, Node<T>* first,
+                       Node<T>* last) noexcept;
+    void     unlinkChain(Node<T>* first, Node<T>* last) noexcept;
+    void     adoptChain(Node<T>* first) noexcept;
+
+    template <class Compare>
+    static void mergeRuns(Node<T>*& first, Node<T>*& second, Compare& cmp);
+    template <class Compare>
+    static void sortChain(Node<T>*& chain, Compare& cmp);
+    static void appendChain(Node<T>*& chain, Node<T>* other) noexcept;
+
+    /// Sorts the list on several threads (see ParallelSort.hpp)
+    template <class U, class Compare>
+    friend void parallelSort(LList<U>& list, Compare cmp, unsigned threads);
+
     Node<T>* head;
     Node<T>* tail;
     size_type count;
+    /// Storage of the nodes; nodes spliced or merged in from another list
+    /// keep their storage, from that list's pool
+    NodePool<Node<T>> pool;
 };  // End: class LList
 
 
@@ -184,32 +376,245 @@ private:
 /* ========== Function Implementations ========== */
 /* ========================================================================== */
 
+/* ========== NodePool ========== */
+/// Takes over the slabs and free slots of other, leaving other empty.
+template <class NodeType>
+NodePool<NodeType>::NodePool(NodePool&& other) noexcept : NodePool() {
+    this->swap(other);
+}
+
+/// Releases the slabs, then takes over the slabs and free slots of other.
+template <class NodeType>
+NodePool<NodeType>& NodePool<NodeType>::operator=(NodePool&& other) noexcept {
+    if (this != &other) {
+        this->release();
+        this->swap(other);
+    }
+
+    return *this;
+}
+
+/// Returns the storage for one node: a free slot if there is one, otherwise
+/// the next unused slot, moving on to the next page of the slab or to a new
+/// slab when the page is full.
+template <class NodeType>
+NodeType* NodePool<NodeType>::allocate() {
+    if (m_free != nullptr) {
+        Slot* slot = m_free;
+        m_free = slot->next;
+        return reinterpret_cast<NodeType*>(slot->node);
+    }
+
+    if (m_next == m_pageEnd) {
+        if (m_page != nullptr && m_page + PAGE != m_slabEnd) {
+            m_page += PAGE;
+            ::new (static_cast<void*>(m_page)) PageHeader{m_current};
+            m_next = m_page + HEADER;
+            m_pageEnd = m_next + PAGE_NODES * sizeof(Slot);
+        } else {
+            grow(m_slabPages);
+            if (m_slabPages < MAX_PAGES) {
+                m_slabPages *= 2;
+            }
+        }
+    }
+
+    NodeType* node = reinterpret_cast<NodeType*>(m_next);
+    m_next += sizeof(Slot);
+    return node;
+}
+
+/// Puts the storage of a destroyed node on the free list.
+template <class NodeType>
+void NodePool<NodeType>::deallocate(NodeType* node) noexcept {
+    Slot* slot = reinterpret_cast<Slot*>(node);
+    slot->next = m_free;
+    m_free = slot;
+}
+
+/// Makes sure the next nodes calls of allocate() that the free list does not
+/// serve come from one slab, in order: if fewer unused slots are left, a
+/// slab with room for nodes slots is added and the unused slots of the old
+/// one are given back. A list copying n elements into an empty pool thus
+/// allocates once, and its nodes lie in memory in list order.
+template <class NodeType>
+void NodePool<NodeType>::reserve(std::size_t nodes) {
+    if (unused() >= nodes) {
+        return;
+    }
+
+    dropUnused();
+    grow((nodes + PAGE_NODES - 1) / PAGE_NODES);
+}
+
+/// Frees the slabs. The nodes must have been destroyed already. If nodes
+/// were exchanged with other pools, the list must also have given its nodes
+/// back with deallocate(): each free slot is then given back to its slab,
+/// which is freed with its last slot, wherever it came from.
+template <class NodeType>
+void NodePool<NodeType>::release() noexcept {
+    if (m_exchanged) {
+        while (m_free != nullptr) {
+            Slot* slot = m_free;
+            m_free = slot->next;
+            drop(slabOf(slot), 1);
+        }
+        dropUnused();
+    } else {
+        while (m_slabs != nullptr) {
+            SlabHeader* slab = m_slabs;
+            m_slabs = slab->next;
+            freeSlab(slab);
+        }
+    }
+
+    m_free = nullptr;
+    m_slabs = m_current = nullptr;
+    m_page = m_next = m_pageEnd = m_slabEnd = nullptr;
+    m_slabPages = 1;
+    m_exchanged = false;
+}
+
+/// Lets nodes move between this pool and other: from now on, until they
+/// are released, both pools give their slots back to the slabs one by one
+/// instead of freeing the slabs they allocated, which may hold nodes of the
+/// other pool's list by then.
+template <class NodeType>
+void NodePool<NodeType>::share(NodePool& other) noexcept {
+    for (NodePool* pool : {this, &other}) {
+        pool->m_exchanged = true;
+        pool->m_slabs = nullptr;
+    }
+}
+
+/// Swaps the slabs and free slots with other.
+template <class NodeType>
+void NodePool<NodeType>::swap(NodePool& other) noexcept {
+    std::swap(m_free, other.m_free);
+    std::swap(m_slabs, other.m_slabs);
+    std::swap(m_current, other.m_current);
+    std::swap(m_page, other.m_page);
+    std::swap(m_next, other.m_next);
+    std::swap(m_pageEnd, other.m_pageEnd);
+    std::swap(m_slabEnd, other.m_slabEnd);
+    std::swap(m_slabPages, other.m_slabPages);
+    std::swap(m_exchanged, other.m_exchanged);
+}
+
+/// Allocates a slab of pages pages, aligned to PAGE, and makes its first
+/// page the page of the unused slots.
+template <class NodeType>
+void NodePool<NodeType>::grow(std::size_t pages) {
+    const std::size_t bytes = pages * PAGE;
+    void*             block = nullptr;
+    unsigned char*    storage = nullptr;
+
+    if (bytes < LARGE_SLAB) {
+        storage = static_cast<unsigned char*>(
+            ::operator new(bytes, std::align_val_t(PAGE)));
+    } else {
+        block = ::operator new(bytes + PAGE - 1);
+        storage = reinterpret_cast<unsigned char*>(
+            (reinterpret_cast<std::uintptr_t>(block) + PAGE - 1) &
+            ~(PAGE - 1));
+    }
+
+    SlabHeader* slab = ::new (static_cast<void*>(storage)) SlabHeader;
+    slab->page.slab = slab;
+    slab->held.store(pages * PAGE_NODES, std::memory_order_relaxed);
+    slab->next = nullptr;
+    slab->block = block;
+    if (!m_exchanged) {
+        slab->next = m_slabs;
+        m_slabs = slab;
+    }
+
+    m_current = slab;
+    m_page = storage;
+    m_next = storage + HEADER;
+    m_pageEnd = m_next + PAGE_NODES * sizeof(Slot);
+    m_slabEnd = storage + pages * PAGE;
+}
+
+/// Returns the number of slots of the current slab never handed out.
+template <class NodeType>
+std::size_t NodePool<NodeType>::unused() const noexcept {
+    if (m_current == nullptr) {
+        return 0;
+    }
+
+    return static_cast<std::size_t>(m_pageEnd - m_next) / sizeof(Slot) +
+           static_cast<std::size_t>(m_slabEnd - m_page) / PAGE * PAGE_NODES -
+           PAGE_NODES;
+}
+
+/// Gives the unused slots of the current slab back to it. A slab left
+/// holding no slot is freed, and taken off the list of slabs.
+template <class NodeType>
+void NodePool<NodeType>::dropUnused() noexcept {
+    const std::size_t slots = unused();
+    if (slots == 0) {
+        return;
+    }
+
+    SlabHeader* slab = m_current;
+    m_current = nullptr;
+    m_page = m_next = m_pageEnd = m_slabEnd = nullptr;
+
+    if (m_slabs == slab) {
+        if (slab->held.load(std::memory_order_relaxed) == slots) {
+            m_slabs = slab->next;
+            freeSlab(slab);
+        } else {
+            slab->held.fetch_sub(slots, std::memory_order_relaxed);
+        }
+    } else {
+        drop(slab, slots);
+    }
+}
+
+/// Gives slots slots back to slab, freeing it with its last slot.
+template <class NodeType>
+void NodePool<NodeType>::drop(SlabHeader* slab, std::size_t slots) noexcept {
+    if (slab->held.fetch_sub(slots, std::memory_order_acq_rel) == slots) {
+        freeSlab(slab);
+    }
+}
+
+/// Frees the storage of slab.
+template <class NodeType>
+void NodePool<NodeType>::freeSlab(SlabHeader* slab) noexcept {
+    void* block = slab->block;
+    slab->~SlabHeader();
+
+    if (block != nullptr) {
+        ::operator delete(block);
+    } else {
+        ::operator delete(static_cast<void*>(slab), std::align_val_t(PAGE));
+    }
+}
+
 /* ========== Constructor/Copy/Destructor: All ========== */
 /// Step 15
 /// Copy: LList
 /// Initializes a new list by deep copying the nodes from other.
-/// Iterates through other, creating new nodes and linking them accordingly.
+/// Reserves one slab for all of other's nodes, then iterates through other,
+/// creating new nodes and linking them accordingly.
 template <class T>
 LList<T>::LList(const LList& other)
     : head(nullptr), tail(nullptr), count(0) {
-    // Set current to other's head
-    Node<T>* current = other.head;
-
-    // Iterate through other and push_back
-    while (current != nullptr) {
-        this->push_back(current->data);
-        current = current->next;
-    }
+    this->appendCopies(other.begin(), other.end(), other.count);
 }
 
 /// Step 16
 /// Move: LList
 /// Takes ownership of other's data, setting head, tail, and count to other's
-/// values.
+/// values, and of the pool holding its nodes.
 /// Sets other's head and tail to nullptr, and count to 0.
 template <class T>
-LList<T>::LList(LList&& other)
-    : head(other.head), tail(other.tail), count(other.count) {
+LList<T>::LList(LList&& other) noexcept
+    : head(other.head), tail(other.tail), count(other.count),
+      pool(std::move(other.pool)) {
     // Set other's values to nullptr or 0
     other.head = nullptr;
     other.tail = nullptr;
@@ -219,36 +624,22 @@ LList<T>::LList(LList&& other)
 /// Step 23
 /// Constructor: LList std::initializer_list<T>
 /// Initializes the list with elements from the initializer list.
-/// Iterates through ilist and inserts each element at the end of the list.
+/// Reserves one slab for all of them, then inserts each element at the end
+/// of the list.
 template <class T>
 LList<T>::LList(std::initializer_list<T> ilist)
     : head(nullptr), tail(nullptr), count(0) {
-    // Insert each item at the end of the list
-    for (const T& item : ilist) {
-        this->push_back(item);
-    }
+    this->appendCopies(ilist.begin(), ilist.end(), ilist.size());
 }
 
 /// Step 8
 /// Destructor: LList
 /// Destroys the list and frees up resources.
-/// Iterates through the list, deleting each node.
+/// Destroys every element, then the pool releases the slabs at once (see
+/// clear).
 template <class T>
 LList<T>::~LList() {
-    // Set current to start
-    Node<T>* current = head;
-
-    // iterate through list, deleting each node
-    while (current != nullptr) {
-        Node<T>* nextNode = current->next;
-        delete current;
-        current = nextNode;
-    }
-
-    // Set all values to nullptr or 0
-    head = nullptr;
-    tail = nullptr;
-    count = 0;
+    this->clear();
 }
 
 /* ======== Dereference Operators (Overloads): BiDirectionalIterator ======== */
@@ -352,7 +743,8 @@ typename LList<T>::BiDirectionalIterator
 /// Step 17
 /// Operator=(const LList& other): LList
 /// Copy assignment operator.
-/// Clears the current list, then deep copies other into the list.
+/// Clears the current list, then deep copies other into the list, in one
+/// slab reserved for all of other's nodes.
 template <class T>
 LList<T>& LList<T>::operator=(const LList& other) {
     // Check for self-assignment
@@ -360,14 +752,8 @@ LList<T>& LList<T>::operator=(const LList& other) {
         // Clear the current list
         this->clear();
 
-        // Set current to other head
-        Node<T>* current = other.head;
-
-        // Iterate and copy all values
-        while (current != nullptr) {
-            this->push_back(current->data);
-            current = current->next;
-        }
+        // Copy all values
+        this->appendCopies(other.begin(), other.end(), other.count);
     }
 
     return *this;
@@ -378,7 +764,7 @@ LList<T>& LList<T>::operator=(const LList& other) {
 /// Move assignment operator.
 /// Swaps the contents of the list with other.
 template <class T>
-LList<T>& LList<T>::operator=(LList&& other) {
+LList<T>& LList<T>::operator=(LList&& other) noexcept {
     // Check for self-assignment
     if (this != &other) {
         // Clear the current list
@@ -388,6 +774,7 @@ LList<T>& LList<T>::operator=(LList&& other) {
         this->head = other.head;
         this->tail = other.tail;
         this->count = other.count;
+        this->pool = std::move(other.pool);
 
         // Set values to nullptr or 0
         other.head = nullptr;
@@ -401,16 +788,15 @@ LList<T>& LList<T>::operator=(LList&& other) {
 /// Step 24
 /// Operator=(std::initializer_list<T> ilist): LList
 /// Assigns the elements of the initializer list to the list.
-/// Clears the current list, then inserts each element from ilist.
+/// Clears the current list, then inserts each element from ilist, in one
+/// slab reserved for all of them.
 template <class T>
 LList<T>& LList<T>::operator=(std::initializer_list<T> ilist) {
     // Clear the current list
     this->clear();
 
-    // Iterate and insert elements from initializer list
-    for (const T& item : ilist) {
-        this->push_back(item);
-    }
+    // Insert elements from initializer list
+    this->appendCopies(ilist.begin(), ilist.end(), ilist.size());
 
     return *this;
 }
@@ -472,12 +858,28 @@ typename LList<T>::const_reference LList<T>::back() const {
 /* ========== Modifiers: LList ========== */
 /// Step 12a
 /// Void push_front(const T& value): LList
-/// Inserts a new element at the front of the list.
-/// Updates head and, if necessary, tail.
+/// Inserts a copy of value at the front of the list.
 template <class T>
 void LList<T>::push_front(const T& value) {
+    emplace_front(value);
+}
+
+/// Void push_front(T&& value): LList
+/// Inserts value at the front of the list, moving it into the new node.
+template <class T>
+void LList<T>::push_front(T&& value) {
+    emplace_front(std::move(value));
+}
+
+/// Reference emplace_front(Args&&... args): LList
+/// Inserts a new element at the front of the list, constructed in place
+/// from args. Updates head and, if necessary, tail.
+/// Returns a reference to the new element.
+template <class T>
+template <class... Args>
+typename LList<T>::reference LList<T>::emplace_front(Args&&... args) {
     // Create a new node
-    Node<T>* newNode = new Node<T>(value);
+    Node<T>* newNode = createNode(std::forward<Args>(args)...);
 
     // Verify if list is empty
     if (head == nullptr) {
@@ -490,6 +892,8 @@ void LList<T>::push_front(const T& value) {
 
     // Increment count
     ++count;
+
+    return newNode->data;
 }
 
 /// Step 14a
@@ -512,7 +916,7 @@ void LList<T>::pop_front() {
         }
 
         // Remove old head
-        delete oldHead;
+        destroyNode(oldHead);
 
         // Decrement count
         --count;
@@ -522,12 +926,28 @@ void LList<T>::pop_front() {
 
 /// Step 12b
 /// Void push_back(const T& value): LList
-/// Adds a new element to the end of the list.
-/// Updates tail and, if necessary, head.
+/// Adds a copy of value to the end of the list.
 template <class T>
 void LList<T>::push_back(const T& value) {
+    emplace_back(value);
+}
+
+/// Void push_back(T&& value): LList
+/// Adds value to the end of the list, moving it into the new node.
+template <class T>
+void LList<T>::push_back(T&& value) {
+    emplace_back(std::move(value));
+}
+
+/// Reference emplace_back(Args&&... args): LList
+/// Adds a new element to the end of the list, constructed in place from
+/// args. Updates tail and, if necessary, head.
+/// Returns a reference to the new element.
+template <class T>
+template <class... Args>
+typename LList<T>::reference LList<T>::emplace_back(Args&&... args) {
     // Create a new node
-    Node<T>* newNode = new Node<T>(value);
+    Node<T>* newNode = createNode(std::forward<Args>(args)...);
 
     // Verify if list is empty
     if (tail == nullptr) {
@@ -540,6 +960,8 @@ void LList<T>::push_back(const T& value) {
 
     // Increment count
     ++count;
+
+    return newNode->data;
 }
 
 /// Step 14b
@@ -565,19 +987,40 @@ void LList<T>::pop_back() {
         --count;
 
         // Remove old tail
-        delete oldTail;
+        destroyNode(oldTail);
     }
 }
 
 /// Step 19
 /// Iterator insert(const_iterator position, const T& value): LList
-/// Inserts a new element before the element at the specified position.
+/// Inserts a copy of value before the element at the specified position.
 /// Returns an iterator pointing to the newly inserted element.
 template <class T>
 typename LList<T>::iterator LList<T>::insert(typename LList<T>::const_iterator
                                              position, const T& value) {
-    // Create a new node with the given value
-    Node<T>* newNode = new Node<T>(value);
+    return emplace(position, value);
+}
+
+/// Iterator insert(const_iterator position, T&& value): LList
+/// Inserts value before the element at the specified position, moving it
+/// into the new node.
+/// Returns an iterator pointing to the newly inserted element.
+template <class T>
+typename LList<T>::iterator LList<T>::insert(typename LList<T>::const_iterator
+                                             position, T&& value) {
+    return emplace(position, std::move(value));
+}
+
+/// Iterator emplace(const_iterator position, Args&&... args): LList
+/// Inserts a new element, constructed in place from args, before the
+/// element at the specified position.
+/// Returns an iterator pointing to the newly inserted element.
+template <class T>
+template <class... Args>
+typename LList<T>::iterator LList<T>::emplace(typename LList<T>::const_iterator
+                                              position, Args&&... args) {
+    // Create a new node from the given arguments
+    Node<T>* newNode = createNode(std::forward<Args>(args)...);
 
     // Verify if list is empty and position is valid
     if (head == nullptr) {
@@ -630,6 +1073,8 @@ typename LList<T>::iterator LList<T>::erase(typename
         head = head->next;
         if (head) {
             head->prev = nullptr;
+        } else {
+            tail = nullptr;
         }
     } else if (nodeToDelete == tail) {
         // Delete last element
@@ -645,7 +1090,7 @@ typename LList<T>::iterator LList<T>::erase(typename
     }
 
     // Free the memory of the node to be erased
-    delete nodeToDelete;
+    destroyNode(nodeToDelete);
 
     // Decrement count
     --count;
@@ -655,7 +1100,7 @@ typename LList<T>::iterator LList<T>::erase(typename
 
 /// step 22
 /// Void swap(LList& other): LList
-/// Swaps the contents of the list with other.
+/// Swaps the contents of the list with other, along with the pools.
 template <class T>
 void LList<T>::swap(LList& other) {
     // Swap the head pointers
@@ -672,28 +1117,359 @@ void LList<T>::swap(LList& other) {
     size_t tempCount = this->count;
     this->count = other.count;
     other.count = tempCount;
+
+    // Swap the pools holding the nodes
+    this->pool.swap(other.pool);
 }
 
 /// Step 21
 /// Void clear() noexcept: LList
 /// Clears the list of all elements.
+/// Destroys each element (unless T is trivially destructible), then releases
+/// the slabs of the pool at once instead of freeing each node. A pool that
+/// exchanged nodes with other lists gets the nodes back one by one first, so
+/// that each goes back to the slab it came from.
 /// Sets head and tail to nullptr and count to 0.
 template <class T>
 void LList<T>::clear() noexcept {
-    // Set current to head
-    Node<T>* current = head;
-
-    // Iterate and delete all elements
-    while (current != nullptr) {
-        Node<T>* next = current->next;
-        delete current;
-        current = next;
+    if (!pool.exchanged()) {
+        // Destroy all elements
+        if (!std::is_trivially_destructible<T>::value) {
+            Node<T>* current = head;
+            while (current != nullptr) {
+                Node<T>* next = current->next;
+                current->~Node();
+                current = next;
+            }
+        }
+    } else {
+        // Return each node to the pool
+        Node<T>* current = head;
+        while (current != nullptr) {
+            Node<T>* next = current->next;
+            destroyNode(current);
+            current = next;
+        }
     }
 
+    // Release all nodes
+    pool.release();
+
     // Set values to nullptr or 0
     head = nullptr;
     tail = nullptr;
     count = 0;
 }
 
+/// Node<T>* createNode(Args&&... args): LList
+/// Constructs a node whose data is constructed from args, in storage from
+/// the pool.
+/// Returns the new node, not yet linked.
+template <class T>
+template <class... Args>
+Node<T>* LList<T>::createNode(Args&&... args) {
+    Node<T>* node = pool.allocate();
+
+    try {
+        return ::new (node) Node<T>(std::in_place,
+                                    std::forward<Args>(args)...);
+    } catch (...) {
+        pool.deallocate(node);
+        throw;
+    }
+}
+
+/// Void destroyNode(Node<T>* node) noexcept: LList
+/// Destroys an unlinked node and returns its storage to the pool.
+template <class T>
+void LList<T>::destroyNode(Node<T>* node) noexcept {
+    node->~Node();
+    pool.deallocate(node);
+}
+
+/// Void appendCopies(InputIt first, InputIt last, size_type n): LList
+/// Appends copies of the n elements of [first, last) to the list. The pool
+/// first reserves room for all n nodes, so that an empty list gets them in
+/// one allocation, laid out in list order. If a copy throws, the list is
+/// cleared, so that a constructor that lets the exception through leaks
+/// nothing.
+template <class T>
+template <class InputIt>
+void LList<T>::appendCopies(InputIt first, InputIt last, size_type n) {
+    if (n == 0) {
+        return;
+    }
+
+    try {
+        pool.reserve(n);
+
+        for (; first != last; ++first) {
+            this->emplace_back(*first);
+        }
+    } catch (...) {
+        this->clear();
+        throw;
+    }
+}
+
+/// Void linkChain(Node<T>* position, Node<T>* first, Node<T>* last): LList
+/// Links the chain of nodes from first to last (inclusive) before position,
+/// or at the end if position is null. count is left to the caller.
+template <class T>
+void LList<T>::linkChain(Node<T>* position, Node<T>* first,
+                         Node<T>* last) noexcept {
+    Node<T>* prevNode = position != nullptr ? position->prev : tail;
+
+    first->prev = prevNode;
+    last->next = position;
+    (prevNode != nullptr ? prevNode->next : head) = first;
+    (position != nullptr ? position->prev : tail) = last;
+}
+
+/// Void unlinkChain(Node<T>* first, Node<T>* last): LList
+/// Unlinks the nodes from first to last (inclusive) from the list, joining
+/// their neighbors. count is left to the caller.
+template <class T>
+void LList<T>::unlinkChain(Node<T>* first, Node<T>* last) noexcept {
+    (first->prev != nullptr ? first->prev->next : head) = last->next;
+    (last->next != nullptr ? last->next->prev : tail) = first->prev;
+}
+
+/// Void adoptChain(Node<T>* first): LList
+/// Makes the chain starting at first, linked by next only and ending in
+/// nullptr, the content of the list: restores the prev links and the tail.
+/// The chain holds the nodes of the list, so count is unchanged.
+template <class T>
+void LList<T>::adoptChain(Node<T>* first) noexcept {
+    Node<T>* prevNode = nullptr;
+    for (Node<T>* node = first; node != nullptr; node = node->next) {
+        node->prev = prevNode;
+        prevNode = node;
+    }
+
+    head = first;
+    tail = prevNode;
+}
+
+/// Void mergeRuns(Node<T>*& first, Node<T>*& second, Compare& cmp): LList
+/// Merges the sorted chain second into the sorted chain first, both linked by
+/// next only; of equal elements, those of first come first. The result is
+/// left in first and second is emptied, even if cmp throws, in which case
+/// first holds all nodes in an unspecified order.
+template <class T>
+template <class Compare>
+void LList<T>::mergeRuns(Node<T>*& first, Node<T>*& second, Compare& cmp) {
+    Node<T>*  a = first;
+    Node<T>*  b = second;
+    Node<T>*  merged = nullptr;
+    Node<T>** last = &merged;
+
+    second = nullptr;
+    try {
+        while (a != nullptr && b != nullptr) {
+            if (cmp(b->data, a->data)) {
+                *last = b;
+                b = b->next;
+            } else {
+                *last = a;
+                a = a->next;
+            }
+            last = &(*last)->next;
+        }
+    } catch (...) {
+        *last = a;
+        appendChain(merged, b);
+        first = merged;
+        throw;
+    }
+
+    *last = a != nullptr ? a : b;
+    first = merged;
+}
+
+/// Void sortChain(Node<T>*& chain, Compare& cmp): LList
+/// Sorts the chain, linked by next only, by cmp (stable). bins[i] holds a
+/// sorted run of 2^i nodes or nothing, the higher bins holding the earlier
+/// nodes; each node taken from the chain is carried up through the filled
+/// bins like a carry through the bits of a binary counter. If cmp throws,
+/// chain keeps all nodes in an unspecified order.
+template <class T>
+template <class Compare>
+void LList<T>::sortChain(Node<T>*& chain, Compare& cmp) {
+    Node<T>*    bins[64] = {};
+    Node<T>*    carry = nullptr;
+    std::size_t used = 0;   // bins that were ever filled
+
+    try {
+        while (chain != nullptr) {
+            carry = chain;
+            chain = chain->next;
+            carry->next = nullptr;
+
+            std::size_t i = 0;
+            for (; i < used && bins[i] != nullptr; ++i) {
+                mergeRuns(bins[i], carry, cmp);
+                carry = bins[i];
+                bins[i] = nullptr;
+            }
+
+            bins[i] = carry;
+            carry = nullptr;
+            if (i == used) {
+                ++used;
+            }
+        }
+
+        // Merge the bins, from the latest nodes to the earliest
+        for (std::size_t i = 0; i < used; ++i) {
+            if (bins[i] != nullptr) {
+                mergeRuns(bins[i], carry, cmp);
+                carry = bins[i];
+                bins[i] = nullptr;
+            }
+        }
+    } catch (...) {
+        appendChain(chain, carry);
+        for (std::size_t i = 0; i < used; ++i) {
+            appendChain(chain, bins[i]);
+        }
+        throw;
+    }
+
+    chain = carry;
+}
+
+/// Void appendChain(Node<T>*& chain, Node<T>* other): LList
+/// Appends the chain other to chain, both linked by next only.
+template <class T>
+void LList<T>::appendChain(Node<T>*& chain, Node<T>* other) noexcept {
+    Node<T>** last = &chain;
+    while (*last != nullptr) {
+        last = &(*last)->next;
+    }
+    *last = other;
+}
+
+/* ========== Operations: LList ========== */
+/// Void splice(const_iterator position, LList& other): LList
+/// Moves all elements of other before position, leaving other empty. The
+/// nodes are relinked, not copied, so this takes constant time and the
+/// iterators to the moved elements stay valid, now referring into this list.
+/// The nodes keep their storage from other's pool, which both pools then
+/// give back node by node when released (see NodePool::share).
+template <class T>
+void LList<T>::splice(const_iterator position, LList& other) {
+    if (this == &other || other.head == nullptr) {
+        return;
+    }
+
+    pool.share(other.pool);
+    linkChain(position.current, other.head, other.tail);
+    count += other.count;
+
+    other.head = nullptr;
+    other.tail = nullptr;
+    other.count = 0;
+}
+
+/// Void splice(const_iterator position, LList& other, const_iterator first,
+///             const_iterator last): LList
+/// Moves the elements [first, last) of other before position, which must not
+/// be within the range; other may be this list. The nodes are relinked, not
+/// copied; between two lists the range is walked once to count it.
+template <class T>
+void LList<T>::splice(const_iterator position, LList& other,
+                      const_iterator first, const_iterator last) {
+    if (first == last) {
+        return;
+    }
+
+    if (this != &other) {
+        pool.share(other.pool);
+
+        size_type moved = 0;
+        for (Node<T>* node = first.current; node != last.current;
+             node = node->next) {
+            ++moved;
+        }
+        other.count -= moved;
+        count += moved;
+    }
+
+    Node<T>* firstNode = first.current;
+    Node<T>* lastNode  = last.current != nullptr ? last.current->prev
+                                                 : other.tail;
+
+    other.unlinkChain(firstNode, lastNode);
+    linkChain(position.current, firstNode, lastNode);
+}
+
+/// Void merge(LList& other, Compare cmp): LList
+/// Merges other, sorted by cmp, into the list, sorted by cmp, leaving other
+/// empty. The merge is stable: of equal elements, those of this list come
+/// first. The nodes of other are relinked one at a time as they are taken,
+/// so if cmp throws both lists stay valid.
+template <class T>
+template <class Compare>
+void LList<T>::merge(LList& other, Compare cmp) {
+    if (this == &other || other.head == nullptr) {
+        return;
+    }
+
+    pool.share(other.pool);
+
+    Node<T>* current = head;
+    while (current != nullptr && other.head != nullptr) {
+        if (cmp(other.head->data, current->data)) {
+            // Take the first node of other
+            Node<T>* node = other.head;
+            other.unlinkChain(node, node);
+            --other.count;
+
+            linkChain(current, node, node);
+            ++count;
+        } else {
+            current = current->next;
+        }
+    }
+
+    // Append the rest of other
+    if (other.head != nullptr) {
+        linkChain(nullptr, other.head, other.tail);
+        count += other.count;
+
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.count = 0;
+    }
+}
+
+/// Void sort(Compare cmp): LList
+/// Sorts the elements by cmp, keeping equal elements in their order (stable).
+/// The nodes are relinked, not moved or copied, so iterators and references
+/// stay valid and no memory is allocated for them. The sort is a bottom-up
+/// merge sort: single nodes are merged into runs of 1, 2, 4, ... nodes kept
+/// in a fixed array of 64 bins, which is all the extra memory it needs.
+///
+/// The sort runs on the calling thread; parallelSort() in ParallelSort.hpp
+/// spreads a long list over several. If cmp throws, the list keeps all of
+/// its elements in an unspecified order.
+template <class T>
+template <class Compare>
+void LList<T>::sort(Compare cmp) {
+    if (count < 2) {
+        return;
+    }
+
+    Node<T>* chain = head;
+    try {
+        sortChain(chain, cmp);
+    } catch (...) {
+        adoptChain(chain);
+        throw;
+    }
+
+    adoptChain(chain);
+}
+
 #endif  // LLIST_HPP
@@ -0,0 +1,136 @@
+/// @file ParallelSort.hpp
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This header file contains parallelSort(), a stable merge sort of
+/// an LList that spreads a long list over several threads. It lives apart
+/// from LList.hpp so that only programs that opt in need <thread> and must
+/// be built with -pthread; LList::sort() always runs on the calling thread.
+///
+/// Example usage:
+/// @code
+///   LList<int> list = readNumbers();           // a million elements
+///   parallelSort(list);                        // same order as list.sort()
+///   parallelSort(list, std::greater<int>());   // cmp is shared by threads
+///   parallelSort(list, std::less<int>(), 2);   // on two threads
+/// @endcode
+
+// Definitions
+#ifndef PARALLEL_SORT_HPP
+#define PARALLEL_SORT_HPP
+
+// Preprocessor Directive(s)
+#include <cstddef>    // provides std::size_t
+#include <exception>  // provides std::exception_ptr
+#include <functional> // provides std::less
+#include <thread>
+
+#include "LList.hpp"
+
+/// Fewest elements parallelSort() splits across worker threads.
+static const std::size_t PARALLEL_SORT_MIN = 1 << 16;
+/// Most threads, including the caller's, that parallelSort() works with.
+static const unsigned PARALLEL_SORT_MAX_THREADS = 8;
+
+/// Void parallelSort(LList<T>& list, Compare cmp, unsigned threads)
+/// Sorts the elements of list by cmp, keeping equal elements in their order
+/// (stable), exactly as list.sort(cmp) does: the nodes are relinked, so
+/// iterators and references stay valid.
+///
+/// Lists of PARALLEL_SORT_MIN elements or more are cut into one sublist per
+/// thread (at most PARALLEL_SORT_MAX_THREADS), which worker threads sort and
+/// merge pairwise; only the threads themselves allocate. cmp is then called
+/// from several threads at once and must allow that. Shorter lists, or a
+/// single thread, are sorted on the calling thread. If cmp throws, the list
+/// keeps all of its elements in an unspecified order.
+///
+/// @param list    The list to sort.
+/// @param cmp     The order of the elements, a strict weak ordering.
+/// @param threads The number of threads to use, including the caller's, or
+///                0 for one per hardware thread.
+template <class T, class Compare = std::less<T>>
+void parallelSort(LList<T>& list, Compare cmp = Compare(),
+                  unsigned threads = 0) {
+    unsigned parts = threads != 0 ? threads
+                                  : std::thread::hardware_concurrency();
+    if (parts > PARALLEL_SORT_MAX_THREADS) {
+        parts = PARALLEL_SORT_MAX_THREADS;
+    }
+
+    if (list.count < PARALLEL_SORT_MIN || parts < 2) {
+        list.sort(cmp);
+        return;
+    }
+
+    // Cut the list into parts sublists of about the same length
+    Node<T>*           pieces[PARALLEL_SORT_MAX_THREADS] = {};
+    std::exception_ptr errors[PARALLEL_SORT_MAX_THREADS];
+    std::thread        workers[PARALLEL_SORT_MAX_THREADS];
+
+    Node<T>* node = list.head;
+    for (unsigned i = 0; i < parts; ++i) {
+        pieces[i] = node;
+
+        std::size_t length = list.count / parts +
+                             (i < list.count % parts ? 1 : 0);
+        while (--length > 0) {
+            node = node->next;
+        }
+
+        Node<T>* next = node->next;
+        node->next = nullptr;
+        node = next;
+    }
+
+    // Each task sorts its sublist, then merges in those of the tasks above
+    // it in a binary tree: task i takes task i + 1, i + 2, i + 4, ... while
+    // i is a multiple of twice the distance, joining each first. Task 0 runs
+    // on the caller's thread; the others are started last to first, so that
+    // a task can run in place if its thread fails to start.
+    auto task = [&](unsigned i) {
+        try {
+            LList<T>::sortChain(pieces[i], cmp);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+
+        for (unsigned stride = 1; i % (2 * stride) == 0 && i + stride < parts;
+             stride *= 2) {
+            if (workers[i + stride].joinable()) {
+                workers[i + stride].join();
+            }
+            if (errors[i] == nullptr && errors[i + stride] == nullptr) {
+                try {
+                    LList<T>::mergeRuns(pieces[i], pieces[i + stride], cmp);
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            }
+        }
+    };
+
+    for (unsigned i = parts - 1; i > 0; --i) {
+        try {
+            workers[i] = std::thread(task, i);
+        } catch (...) {
+            task(i);
+        }
+    }
+    task(0);
+
+    for (unsigned i = 0; i < parts; ++i) {
+        if (errors[i] != nullptr) {
+            for (unsigned j = 1; j < parts; ++j) {
+                LList<T>::appendChain(pieces[0], pieces[j]);
+            }
+            list.adoptChain(pieces[0]);
+            std::rethrow_exception(errors[i]);
+        }
+    }
+
+    list.adoptChain(pieces[0]);
+}
+
+#endif  // PARALLEL_SORT_HPP
+
+// EOF: ParallelSort.hpp
@@ -0,0 +1,245 @@
+/// @file UnrolledLList-test.cxx
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file contains Catch2 unit tests for the UnrolledLList class:
+/// its LList interface against std::list, the iterators returned by insert()
+/// and erase(), and how full erase() keeps the nodes.
+
+#include <algorithm>
+#include <cstddef>  // provides std::size_t
+#include <iterator>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+
+#include "UnrolledLList.hpp"
+#include "UnrolledLList.hpp"  // test include guard
+
+/// Returns the number of elements in each node of list, front to back.
+template <class T, std::size_t K>
+static std::vector<std::size_t> nodeCounts(UnrolledLList<T, K>& list) {
+    std::vector<std::size_t> counts;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        if (it.index == 0) {
+            counts.push_back(0);
+        }
+        ++counts.back();
+    }
+    return counts;
+}
+
+/// Checks that list holds the elements of expected, in order, both ways.
+template <class T, std::size_t K>
+static void checkSame(UnrolledLList<T, K>& list, const std::list<T>& expected) {
+    REQUIRE(list.size() == expected.size());
+    CHECK(list.empty() == expected.empty());
+    CHECK(std::equal(list.begin(), list.end(), expected.begin()));
+
+    // end() cannot be decremented; walk back from the last element instead
+    if (!expected.empty()) {
+        auto it = std::next(list.begin(), list.size() - 1);
+        for (auto exp = expected.rbegin(); exp != expected.rend(); ++exp) {
+            REQUIRE(*it == *exp);
+            --it;
+        }
+        CHECK(it == list.end());
+    }
+}
+
+TEST_CASE("UnrolledLList construction", "[UnrolledLList]") {
+    SECTION("Default constructor") {
+        UnrolledLList<int> list;
+        CHECK(list.empty());
+        CHECK(list.size() == 0);
+        CHECK(list.begin() == list.end());
+    }
+
+    SECTION("Initializer list constructor") {
+        UnrolledLList<int, 4> list = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+        checkSame(list, {1, 2, 3, 4, 5, 6, 7, 8, 9});
+    }
+
+    SECTION("Copy constructor") {
+        UnrolledLList<std::string, 4> list = {"a", "b", "c", "d", "e"};
+        UnrolledLList<std::string, 4> copy(list);
+        list.pop_front();
+        checkSame(copy, {"a", "b", "c", "d", "e"});
+        checkSame(list, {"b", "c", "d", "e"});
+    }
+
+    SECTION("Move constructor") {
+        static_assert(std::is_nothrow_move_constructible<
+                          UnrolledLList<std::string>>::value,
+                      "moving a list must not throw");
+        UnrolledLList<std::string, 4> list = {"a", "b", "c", "d", "e"};
+        UnrolledLList<std::string, 4> moved(std::move(list));
+        checkSame(moved, {"a", "b", "c", "d", "e"});
+        CHECK(list.empty());
+    }
+}
+
+TEST_CASE("UnrolledLList element access", "[UnrolledLList]") {
+    UnrolledLList<int, 4> list;
+
+    SECTION("front() and back() throw on an empty list") {
+        CHECK_THROWS_AS(list.front(), std::out_of_range);
+        CHECK_THROWS_AS(list.back(), std::out_of_range);
+        CHECK_THROWS_AS(*list.end(), std::runtime_error);
+        CHECK_THROWS_AS(list.erase(list.end()), std::invalid_argument);
+    }
+
+    SECTION("front() and back() across nodes") {
+        for (int i = 0; i < 10; ++i) {
+            list.push_back(i);
+        }
+        CHECK(list.front() == 0);
+        CHECK(list.back() == 9);
+        list.push_front(-1);
+        CHECK(list.front() == -1);
+        list.pop_back();
+        CHECK(list.back() == 8);
+    }
+}
+
+TEST_CASE("UnrolledLList insert() and erase() iterators", "[UnrolledLList]") {
+    UnrolledLList<int, 4> list;
+    std::list<int> expected;
+
+    SECTION("insert() returns the inserted element") {
+        auto pos = list.end();
+        for (int i = 0; i < 20; ++i) {
+            pos = list.insert(pos, i);
+            CHECK(*pos == i);
+            expected.push_front(i);
+        }
+        checkSame(list, expected);
+    }
+
+    SECTION("erase() returns the following element") {
+        for (int i = 0; i < 40; ++i) {
+            list.push_back(i);
+            expected.push_back(i);
+        }
+
+        // erase every other element, walking with the returned iterator
+        auto it = list.begin();
+        auto exp = expected.begin();
+        while (it != list.end()) {
+            it = list.erase(it);
+            exp = expected.erase(exp);
+            if (exp == expected.end()) {
+                CHECK(it == list.end());
+                break;
+            }
+            CHECK(*it == *exp);
+            ++it;
+            ++exp;
+        }
+        checkSame(list, expected);
+    }
+
+    SECTION("erase() at the back returns end()") {
+        for (int i = 0; i < 9; ++i) {
+            list.push_back(i);
+        }
+        while (!list.empty()) {
+            auto last = std::next(list.begin(), list.size() - 1);
+            CHECK(list.erase(last) == list.end());
+        }
+    }
+}
+
+TEST_CASE("UnrolledLList keeps its nodes a quarter full", "[UnrolledLList]") {
+    UnrolledLList<int, 32> list;
+    std::list<int> expected;
+    for (int i = 0; i < 32000; ++i) {
+        list.push_back(i);
+        expected.push_back(i);
+    }
+
+    SECTION("erasing 31 of every 32 elements") {
+        auto it = list.begin();
+        for (int i = 0; it != list.end(); ++i) {
+            it = i % 32 != 0 ? list.erase(it) : std::next(it);
+        }
+        expected.remove_if([](int value) { return value % 32 != 0; });
+        checkSame(list, expected);
+
+        // 1000 elements in nodes of at least 8 are at most 125 nodes
+        std::vector<std::size_t> counts = nodeCounts(list);
+        CHECK(counts.size() <= 125);
+        for (std::size_t i = 0; i + 1 < counts.size(); ++i) {
+            CHECK(counts[i] >= 8);
+        }
+    }
+
+    SECTION("erasing from the front and from the back of each node") {
+        auto it = list.begin();
+        for (int i = 0; it != list.end(); ++i) {
+            it = i % 64 < 48 ? list.erase(it) : std::next(it);
+        }
+        expected.remove_if([](int value) { return value % 64 < 48; });
+        checkSame(list, expected);
+
+        for (std::size_t count : nodeCounts(list)) {
+            CHECK(count >= 8);
+        }
+    }
+}
+
+TEST_CASE("UnrolledLList matches std::list under random edits",
+          "[UnrolledLList]") {
+    std::mt19937 random(202);
+    UnrolledLList<int, 8> list;
+    std::list<int> expected;
+
+    for (int step = 0; step < 20000; ++step) {
+        std::size_t where = expected.empty() ? 0 : random() % expected.size();
+        auto it = std::next(list.begin(), where);
+        auto exp = std::next(expected.begin(), where);
+
+        // insert more often than erase while the list is short
+        unsigned inserts = expected.size() < 200 ? 60 : 40;
+        if (expected.empty() || random() % 100 < inserts) {
+            it = list.insert(it, step);
+            exp = expected.insert(exp, step);
+            REQUIRE(*it == *exp);
+        } else {
+            it = list.erase(it);
+            exp = expected.erase(exp);
+            REQUIRE((it == list.end()) == (exp == expected.end()));
+            if (exp != expected.end()) {
+                REQUIRE(*it == *exp);
+            }
+        }
+    }
+    checkSame(list, expected);
+
+    std::vector<std::size_t> counts = nodeCounts(list);
+    for (std::size_t i = 0; i + 1 < counts.size(); ++i) {
+        CHECK(counts[i] >= 2);
+    }
+}
+
+TEST_CASE("UnrolledLList swap and clear", "[UnrolledLList]") {
+    UnrolledLList<std::string, 4> first = {"a", "b", "c", "d", "e"};
+    UnrolledLList<std::string, 4> second = {"z"};
+
+    first.swap(second);
+    checkSame(first, {"z"});
+    checkSame(second, {"a", "b", "c", "d", "e"});
+
+    second.clear();
+    CHECK(second.empty());
+    second.push_back("y");
+    checkSame(second, {"y"});
+}
+
+// EOF: UnrolledLList-test.cxx
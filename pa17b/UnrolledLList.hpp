@@ -0,0 +1,746 @@
+/// @file UnrolledLList.hpp
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This header file contains the class "UnrolledLList", a linked list
+/// whose nodes hold up to K elements side by side instead of one. It offers
+/// the interface of LList (push_*, pop_*, insert, erase and a bidirectional
+/// iterator), so code written against LList runs on it unchanged as long as
+/// it keeps the iterators returned by insert and erase. Walking the list
+/// touches one node per K elements and reads each node like an array, while
+/// inserting in the middle still only shifts the elements of a single node.
+///
+/// Example usage:
+/// @code
+///   UnrolledLList<int> list;
+///   auto pos = list.end();
+///   pos = std::next(list.insert(pos, 1));   // keeps pos before the same
+///   pos = std::next(list.insert(pos, 2));   // element, like LList's pos
+///   for (int value : list) { std::cout << value << ' '; }
+/// @endcode
+
+// Definitions
+#ifndef UNROLLED_LLIST_HPP
+#define UNROLLED_LLIST_HPP
+
+// Preprocessor Directive(s)
+#include <cstddef>  // provides std::size_t
+#include <functional>  // provides std::less
+#include <initializer_list>
+#include <iterator>
+#include <new>      // provides placement new and std::launder
+#include <stdexcept>
+#include <type_traits>
+#include <utility>  // provides std::move and std::swap
+
+#include "LList.hpp"  // provides NodePool
+
+/* ========================================================================== */
+/* ========== Class/Struct Definition(s) ========= */
+/* ========================================================================== */
+/// UnrolledNode is a node of an UnrolledLList. It links to the previous and
+/// next nodes like Node does, but stores up to K elements in place, of which
+/// the first count are constructed.
+template <class T, std::size_t K>
+struct UnrolledNode {
+    /// Constructs an empty node linked to prev_node and next_node.
+    explicit UnrolledNode(UnrolledNode* prev_node = nullptr,
+                          UnrolledNode* next_node = nullptr)
+        : prev(prev_node), next(next_node), count(0) {}
+
+    /// Returns a pointer to the element at index i.
+    T* item(std::size_t i) {
+        return std::launder(reinterpret_cast<T*>(storage) + i);
+    }
+
+    UnrolledNode* prev;   ///< Pointer to the previous node
+    UnrolledNode* next;   ///< Pointer to the next node
+    std::size_t   count;  ///< Number of elements in the node
+    alignas(T) unsigned char storage[K * sizeof(T)];  ///< The elements
+};  // End: struct UnrolledNode
+
+
+/// UnrolledLList is a doubly-linked list of nodes holding up to K elements
+/// each. A full node is split in half to make room. A node whose elements
+/// are erased is merged with its successor once both fit in half a node,
+/// and once it falls below a quarter full it takes over a neighbour that
+/// fits in three quarters of a node, or borrows elements from a fuller one.
+/// Every node thus stays at least a quarter full, except a lone node and
+/// the last node after pop_back().
+///
+/// Unlike LList, inserting or erasing an element moves the elements behind
+/// it in the same node, which invalidates the iterators to them. insert()
+/// and erase() return the iterators to use next, as std::vector does.
+///
+/// @tparam T Type of the elements.
+/// @tparam K Most elements in one node.
+template <class T, std::size_t K = 32>
+class UnrolledLList {
+    static_assert(K >= 2, "a node must hold at least two elements");
+
+    using node_type = UnrolledNode<T, K>;
+
+public:
+    /// The BiDirectionalIterator struct iterates over the elements of an
+    /// UnrolledLList in both directions. It designates an element by its node
+    /// and its index within the node; the end iterator has no node. Like
+    /// LList's iterator, it throws when a null iterator is dereferenced,
+    /// incremented or decremented.
+    struct BiDirectionalIterator {
+        // Iterator traits
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        /// Constructor: BiDirectionalIterator
+        /// Designates element index of node ptr, or the end (default).
+        explicit BiDirectionalIterator(node_type* ptr = nullptr,
+                                       std::size_t pos = 0)
+        : current(ptr), index(pos) {};
+
+        // Dereference operators
+        reference operator*() const;
+        pointer operator->() const;
+
+        // Increment/decrement operators
+        BiDirectionalIterator& operator++();
+        BiDirectionalIterator operator++(int ignored);
+        BiDirectionalIterator& operator--();
+        BiDirectionalIterator operator--(int ignored);
+
+        // Equality/Inequality comparison operators
+        /// Checks if two iterators are/not designating the same element.
+        bool operator==(const BiDirectionalIterator& other) const
+        { return current == other.current && index == other.index; }
+        bool operator!=(const BiDirectionalIterator& other) const
+        { return !(*this == other); }
+
+        node_type*  current;  ///< Node holding the element
+        std::size_t index;    ///< Index of the element within the node
+    };  // End: struct BiDirectionalIterator
+
+    // types
+    using value_type = T;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = BiDirectionalIterator;
+    using const_iterator = const iterator;
+
+    // construct/copy/destroy
+    /// Constructor: UnrolledLList
+    /// Initializes an empty list.
+    UnrolledLList() : head(nullptr), tail(nullptr), count(0) {};
+    UnrolledLList(const UnrolledLList& other);
+    UnrolledLList(UnrolledLList&& other) noexcept;
+    UnrolledLList(std::initializer_list<T> ilist);
+    virtual ~UnrolledLList();
+
+    // assignment
+    UnrolledLList& operator=(const UnrolledLList& other);
+    UnrolledLList& operator=(UnrolledLList&& other) noexcept;
+    UnrolledLList& operator=(std::initializer_list<T> ilist);
+
+    // iterators
+    /// Returns an iterator pointing to the first element / past the last.
+    iterator       begin() noexcept { return iterator(head); }
+    const_iterator begin() const noexcept { return const_iterator(head); }
+    iterator       end() noexcept { return iterator(nullptr); }
+    const_iterator end() const noexcept { return const_iterator(nullptr); }
+
+    // capacity
+    /// Returns true if the list is empty, otherwise false, and the number of
+    /// elements in the list.
+    bool empty() const noexcept { return head == nullptr; }
+    size_type size() const noexcept { return count; }
+
+    // element access
+    reference       front();
+    const_reference front() const;
+    reference       back();
+    const_reference back() const;
+
+    // modifiers
+    void     push_front(const T& value);
+    void     pop_front();
+    void     push_back(const T& value);
+    void     pop_back();
+    iterator insert(const_iterator position, const T& value);
+    iterator erase(const_iterator position);
+    void     swap(UnrolledLList& other);
+    void     clear() noexcept;
+
+private:
+    node_type* createNode(node_type* prev, node_type* next);
+    void       destroyNode(node_type* node) noexcept;
+    node_type* split(node_type* node);
+    void       unlinkNode(node_type* node) noexcept;
+    void       moveFront(node_type* from, size_type n, node_type* to);
+    void       moveBack(node_type* from, size_type n, node_type* to);
+    iterator   insertAt(node_type* node, size_type index, const T& value);
+
+    node_type* head;
+    node_type* tail;
+    size_type  count;
+    NodePool<node_type> pool;  ///< Storage of the nodes
+};  // End: class UnrolledLList
+
+
+/* ========================================================================== */
+/* ========== Function Implementations ========== */
+/* ========================================================================== */
+
+/* ========== Constructor/Copy/Destructor: All ========== */
+/// Copy: UnrolledLList
+/// Initializes a new list by copying the elements of other, packing the
+/// nodes full.
+template <class T, std::size_t K>
+UnrolledLList<T, K>::UnrolledLList(const UnrolledLList& other)
+    : head(nullptr), tail(nullptr), count(0) {
+    for (const T& item : other) {
+        this->push_back(item);
+    }
+}
+
+/// Move: UnrolledLList
+/// Takes ownership of other's nodes and the pool holding them, leaving other
+/// empty.
+template <class T, std::size_t K>
+UnrolledLList<T, K>::UnrolledLList(UnrolledLList&& other) noexcept
+    : head(other.head), tail(other.tail), count(other.count),
+      pool(std::move(other.pool)) {
+    other.head = nullptr;
+    other.tail = nullptr;
+    other.count = 0;
+}
+
+/// Constructor: UnrolledLList std::initializer_list<T>
+/// Initializes the list with the elements of ilist, in order.
+template <class T, std::size_t K>
+UnrolledLList<T, K>::UnrolledLList(std::initializer_list<T> ilist)
+    : head(nullptr), tail(nullptr), count(0) {
+    for (const T& item : ilist) {
+        this->push_back(item);
+    }
+}
+
+/// Destructor: UnrolledLList
+/// Destroys every element, then the pool releases the nodes at once.
+template <class T, std::size_t K>
+UnrolledLList<T, K>::~UnrolledLList() {
+    this->clear();
+}
+
+/* ======== Dereference Operators (Overloads): BiDirectionalIterator ======== */
+/// Reference Operator*(): BiDirectionalIterator
+/// Returns a reference to the designated element.
+template <class T, std::size_t K>
+typename UnrolledLList<T, K>::BiDirectionalIterator::reference
+         UnrolledLList<T, K>::BiDirectionalIterator::operator*() const {
+    // Verify current is not a nullptr
+    if (current == nullptr) {
+        throw std::runtime_error("Dereferencing a null iterator");
+    }
+
+    return *current->item(index);
+}
+
+/// Pointer Operator->(): BiDirectionalIterator
+/// Returns a pointer to the designated element.
+template <class T, std::size_t K>
+typename UnrolledLList<T, K>::BiDirectionalIterator::pointer
+         UnrolledLList<T, K>::BiDirectionalIterator::operator->() const {
+    // Verify current is not a nullptr
+    if (current == nullptr) {
+        throw std::runtime_error("Dereferencing a null iterator");
+    }
+
+    return current->item(index);
+}
+
+/* ========== Increment/Decrement Operators: BiDirectionalIterator ========== */
+/// Operator++(): BiDirectionalIterator&
+/// Prefix increment. Advances to the next element, which is the first
+/// element of the next node once the current node is exhausted.
+template <class T, std::size_t K>
+typename UnrolledLList<T, K>::BiDirectionalIterator&
+         UnrolledLList<T, K>::BiDirectionalIterator::operator++() {
+    // Verify current is not a nullptr
+    if (current == nullptr) {
+        throw std::runtime_error("Error: Attempt to increment null iterator.");
+    }
+
+    if (++index == current->count) {
+        current = current->next;
+        index = 0;
+    }
+
+    return *this;
+}
+
+/// Operator++(int ignored): BiDirectionalIterator
+/// Postfix increment. Advances the iterator but returns it as it was before.
+template <class T, std::size_t K>
+typename UnrolledLList<T, K>::BiDirectionalIterator
+         UnrolledLList<T, K>::BiDirectionalIterator::operator++(int) {
+    BiDirectionalIterator copy = *this;
+
+    operator++();
+    return copy;
+}
+
+/// Operator--(): BiDirectionalIterator&
+/// Prefix decrement. Moves to the previous element, which is the last
+/// element of the previous node at the start of a node. Moving before the
+/// first element gives a null iterator.
+template <class T, std::size_t K>
+typename UnrolledLList<T, K>::BiDirectionalIterator&
+         UnrolledLList<T, K>::BiDirectionalIterator::operator--() {
+    // Verify current is not a nullptr
+    if (current == nullptr) {
+        throw std::runtime_error("Error: Attempt to decrement null iterator.");
+    }
+
+    if (index > 0) {
+        --index;
+    } else {
+        current = current->prev;
+        index = current != nullptr ? current->count - 1 : 0;
+    }
+
+    return *this;
+}
+
+/// Operator--(int ignored): BiDirectionalIterator
+/// Postfix decrement. Moves the iterator back but returns it as it was
+/// before.
+template <class T, std::size_t K>
+typename UnrolledLList<T, K>::BiDirectionalIterator
+         UnrolledLList<T, K>::BiDirectionalIterator::operator--(int) {
+    BiDirectionalIterator copy = *this;
+
+    operator--();
+    return copy;
+}
+
+/* ========== Assignment: UnrolledLList ========== */
+/// Operator=(const UnrolledLList& other): UnrolledLList
+/// Copy assignment operator. Clears the list, then copies other into it.
+template <class T, std::size_t K>
+UnrolledLList<T, K>& UnrolledLList<T, K>::operator=(
+                                            const UnrolledLList& other) {
+    if (this != &other) {
+        this->clear();
+        for (const T& item : other) {
+            this->push_back(item);
+        }
+    }
+
+    return *this;
+}
+
+/// Operator=(UnrolledLList&& other): UnrolledLList
+/// Move assignment operator. Clears the list, then takes over other's nodes
+/// and pool.
+template <class T, std::size_t K>
+UnrolledLList<T, K>& UnrolledLList<T, K>::operator=(
+                                            UnrolledLList&& other) noexcept {
+    if (this != &other) {
+        this->clear();
+
+        this->head = other.head;
+        this->tail = other.tail;
+        this->count = other.count;
+        this->pool = std::move(other.pool);
+
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.count = 0;
+    }
+
+    return *this;
+}
+
+/// Operator=(std::initializer_list<T> ilist): UnrolledLList
+/// Clears the list, then appends each element of ilist.
+template <class T, std::size_t K>
+UnrolledLList<T, K>& UnrolledLList<T, K>::operator=(
+                                            std::initializer_list<T> ilist) {
+    this->clear();
+    for (const T& item : ilist) {
+        this->push_back(item);
+    }
+
+    return *this;
+}
+
+/* ========== Element Access: UnrolledLList ========== */
+/// Reference front(): UnrolledLList
+/// Returns a reference to the first element in the list.
+template <class T, std::size_t K>
+typename UnrolledLList<T, K>::reference UnrolledLList<T, K>::front() {
+    if (head == nullptr) {
+        throw std::out_of_range("Accessing front on an empty list");
+    }
+
+    return *head->item(0);
+}
+
+/// Const_reference front() const: UnrolledLList
+/// Returns a reference to the first element in the list.
+template <class T, std::size_t K>
+typename UnrolledLList<T, K>::const_reference
+         UnrolledLList<T, K>::front() const {
+    if (head == nullptr) {
+        throw std::out_of_range("Accessing front on an empty list");
+    }
+
+    return *head->item(0);
+}
+
+/// Reference back(): UnrolledLList
+/// Returns a reference to the last element in the list.
+template <class T, std::size_t K>
+typename UnrolledLList<T, K>::reference UnrolledLList<T, K>::back() {
+    if (tail == nullptr) {
+        throw std::out_of_range("Accessing back on an empty list");
+    }
+
+    return *tail->item(tail->count - 1);
+}
+
+/// Const_reference back() const: UnrolledLList
+/// Returns a reference to the last element in the list.
+template <class T, std::size_t K>
+typename UnrolledLList<T, K>::const_reference
+         UnrolledLList<T, K>::back() const {
+    if (tail == nullptr) {
+        throw std::out_of_range("Accessing back on an empty list");
+    }
+
+    return *tail->item(tail->count - 1);
+}
+
+/* ========== Modifiers: UnrolledLList ========== */
+/// Void push_front(const T& value): UnrolledLList
+/// Inserts a new element at the front of the list.
+template <class T, std::size_t K>
+void UnrolledLList<T, K>::push_front(const T& value) {
+    insertAt(head, 0, value);
+}
+
+/// Void pop_front(): UnrolledLList
+/// Removes the first element of the list, if any.
+template <class T, std::size_t K>
+void UnrolledLList<T, K>::pop_front() {
+    if (head != nullptr) {
+        erase(begin());
+    }
+}
+
+/// Void push_back(const T& value): UnrolledLList
+/// Adds a new element to the end of the list, in a new node when the last
+/// one is full.
+template <class T, std::size_t K>
+void UnrolledLList<T, K>::push_back(const T& value) {
+    insertAt(nullptr, 0, value);
+}
+
+/// Void pop_back(): UnrolledLList
+/// Removes the last element of the list, if any, and the last node with it
+/// once it is empty.
+template <class T, std::size_t K>
+void UnrolledLList<T, K>::pop_back() {
+    if (tail != nullptr) {
+        tail->item(--tail->count)->~T();
+        --count;
+
+        if (tail->count == 0) {
+            node_type* oldTail = tail;
+            tail = tail->prev;
+            if (tail != nullptr) {
+                tail->next = nullptr;
+            } else {
+                head = nullptr;
+            }
+            destroyNode(oldTail);
+        }
+    }
+}
+
+/// Iterator insert(const_iterator position, const T& value): UnrolledLList
+/// Inserts a new element before the element at the specified position.
+/// Returns an iterator pointing to the newly inserted element; the element
+/// at position follows it, so std::next of the result takes the place of
+/// position, which may have been invalidated.
+template <class T, std::size_t K>
+typename UnrolledLList<T, K>::iterator
+         UnrolledLList<T, K>::insert(const_iterator position, const T& value) {
+    return insertAt(position.current, position.index, value);
+}
+
+/// Iterator erase(const_iterator position): UnrolledLList
+/// Removes the element at position, moving the elements behind it in its
+/// node up by one. An emptied node is unlinked. A node that fits in half a
+/// node together with its successor takes over the successor's elements; a
+/// node left less than a quarter full is merged with its successor or its
+/// predecessor if the two fit in three quarters of a node, and otherwise
+/// borrows elements from one of them until both hold about as many.
+/// Returns the iterator following the removed element.
+template <class T, std::size_t K>
+typename UnrolledLList<T, K>::iterator
+         UnrolledLList<T, K>::erase(const_iterator position) {
+    // Verify if list is empty and position is valid
+    if (head == nullptr || position.current == nullptr) {
+        throw std::invalid_argument("Out of Range!");
+    }
+
+    node_type* node  = position.current;
+    size_type  index = position.index;
+
+    // Close the gap
+    for (size_type i = index + 1; i < node->count; ++i) {
+        *node->item(i - 1) = std::move(*node->item(i));
+    }
+    node->item(--node->count)->~T();
+    --count;
+
+    if (node->count == 0) {
+        node_type* next = node->next;
+        unlinkNode(node);
+
+        return iterator(next);
+    }
+
+    // Rebalance with the neighbours; index follows the element after the
+    // removed one
+    node_type*      next = node->next;
+    node_type*      prev = node->prev;
+    const bool      underfull = node->count < K / 4;
+    const size_type most = underfull ? K * 3 / 4 : K / 2;
+
+    if (next != nullptr && node->count + next->count <= most) {
+        // Merge the successor into the node
+        moveFront(next, next->count, node);
+        unlinkNode(next);
+    } else if (underfull && prev != nullptr &&
+               prev->count + node->count <= most) {
+        // Merge the node into its predecessor
+        index += prev->count;
+        moveFront(node, node->count, prev);
+        unlinkNode(node);
+        node = prev;
+    } else if (underfull && next != nullptr) {
+        // Borrow the first elements of the successor
+        moveFront(next, (next->count - node->count) / 2, node);
+    } else if (underfull && prev != nullptr) {
+        // Borrow the last elements of the predecessor
+        const size_type borrowed = (prev->count - node->count) / 2;
+        moveBack(prev, borrowed, node);
+        index += borrowed;
+    }
+
+    return index < node->count ? iterator(node, index) : iterator(node->next);
+}
+
+/// Void swap(UnrolledLList& other): UnrolledLList
+/// Swaps the contents of the list with other, along with the pools.
+template <class T, std::size_t K>
+void UnrolledLList<T, K>::swap(UnrolledLList& other) {
+    std::swap(this->head, other.head);
+    std::swap(this->tail, other.tail);
+    std::swap(this->count, other.count);
+    this->pool.swap(other.pool);
+}
+
+/// Void clear() noexcept: UnrolledLList
+/// Destroys all elements, then releases the nodes of the pool at once.
+template <class T, std::size_t K>
+void UnrolledLList<T, K>::clear() noexcept {
+    if (!std::is_trivially_destructible<T>::value) {
+        for (node_type* node = head; node != nullptr; node = node->next) {
+            for (size_type i = 0; i < node->count; ++i) {
+                node->item(i)->~T();
+            }
+        }
+    }
+
+    pool.release();
+
+    head = nullptr;
+    tail = nullptr;
+    count = 0;
+}
+
+/// Node_type* createNode(node_type* prev, node_type* next): UnrolledLList
+/// Constructs an empty node in storage from the pool and links it between
+/// prev and next (either may be null for the ends of the list).
+template <class T, std::size_t K>
+typename UnrolledLList<T, K>::node_type*
+         UnrolledLList<T, K>::createNode(node_type* prev, node_type* next) {
+    node_type* node = ::new (pool.allocate()) node_type(prev, next);
+
+    (prev != nullptr ? prev->next : head) = node;
+    (next != nullptr ? next->prev : tail) = node;
+
+    return node;
+}
+
+/// Void destroyNode(node_type* node) noexcept: UnrolledLList
+/// Returns the storage of an unlinked, empty node to the pool.
+template <class T, std::size_t K>
+void UnrolledLList<T, K>::destroyNode(node_type* node) noexcept {
+    node->~node_type();
+    pool.deallocate(node);
+}
+
+/// Void unlinkNode(node_type* node) noexcept: UnrolledLList
+/// Unlinks an empty node from the list and returns it to the pool.
+template <class T, std::size_t K>
+void UnrolledLList<T, K>::unlinkNode(node_type* node) noexcept {
+    (node->prev != nullptr ? node->prev->next : head) = node->next;
+    (node->next != nullptr ? node->next->prev : tail) = node->prev;
+    destroyNode(node);
+}
+
+/// Void moveFront(node_type* from, size_type n, node_type* to): UnrolledLList
+/// Moves the first n elements of from to the end of to, which must have
+/// room for them, and the remaining elements of from down by n.
+template <class T, std::size_t K>
+void UnrolledLList<T, K>::moveFront(node_type* from, size_type n,
+                                    node_type* to) {
+    for (size_type i = 0; i < n; ++i) {
+        ::new (to->item(to->count + i)) T(std::move(*from->item(i)));
+    }
+    for (size_type i = n; i < from->count; ++i) {
+        *from->item(i - n) = std::move(*from->item(i));
+    }
+    for (size_type i = from->count - n; i < from->count; ++i) {
+        from->item(i)->~T();
+    }
+
+    to->count += n;
+    from->count -= n;
+}
+
+/// Void moveBack(node_type* from, size_type n, node_type* to): UnrolledLList
+/// Moves the last n elements of from to the front of to, which must have
+/// room for them, after moving the elements of to up by n.
+template <class T, std::size_t K>
+void UnrolledLList<T, K>::moveBack(node_type* from, size_type n,
+                                   node_type* to) {
+    // Make room: elements moved past the old end are constructed there
+    for (size_type i = to->count; i-- > 0;) {
+        if (i + n >= to->count) {
+            ::new (to->item(i + n)) T(std::move(*to->item(i)));
+        } else {
+            *to->item(i + n) = std::move(*to->item(i));
+        }
+    }
+
+    for (size_type i = 0; i < n; ++i) {
+        T* source = from->item(from->count - n + i);
+        if (i < to->count) {
+            *to->item(i) = std::move(*source);
+        } else {
+            ::new (to->item(i)) T(std::move(*source));
+        }
+        source->~T();
+    }
+
+    to->count += n;
+    from->count -= n;
+}
+
+/// Node_type* split(node_type* node): UnrolledLList
+/// Moves the upper half of a full node into a new node linked after it.
+/// Returns the new node.
+template <class T, std::size_t K>
+typename UnrolledLList<T, K>::node_type*
+         UnrolledLList<T, K>::split(node_type* node) {
+    node_type* upper = createNode(node, node->next);
+    const size_type keep = node->count / 2;
+
+    for (size_type i = keep; i < node->count; ++i) {
+        ::new (upper->item(i - keep)) T(std::move(*node->item(i)));
+        node->item(i)->~T();
+    }
+    upper->count = node->count - keep;
+    node->count = keep;
+
+    return upper;
+}
+
+/// Iterator insertAt(node_type* node, size_type index, const T& value)
+/// Inserts value before element index of node, or at the end of the list if
+/// node is null. An element that would start a node goes to the end of the
+/// previous node when it has room; otherwise a full node is split first.
+/// Returns an iterator pointing to the new element.
+template <class T, std::size_t K>
+typename UnrolledLList<T, K>::iterator
+         UnrolledLList<T, K>::insertAt(node_type* node, size_type index,
+                                       const T& value) {
+    // Append to the previous node, if any, rather than shifting a node
+    if (index == 0) {
+        node_type* prev = node != nullptr ? node->prev : tail;
+        if (prev != nullptr && prev->count < K) {
+            node  = prev;
+            index = prev->count;
+        } else if (node == nullptr) {
+            node = createNode(tail, nullptr);
+        }
+    }
+
+    // Make room in a full node, copying value first if it is one of the
+    // elements about to move
+    if (node->count == K) {
+        const std::less<const T*> before;
+        const T* first = node->item(0);
+        if (!before(&value, first) && before(&value, first + K)) {
+            const T copy(value);
+            return insertAt(node, index, copy);
+        }
+
+        node_type* upper = split(node);
+        if (index > node->count) {
+            index -= node->count;
+            node = upper;
+        }
+    }
+
+    if (index == node->count) {
+        // Append to the node, dropping it again if it is new and the copy
+        // throws
+        try {
+            ::new (node->item(index)) T(value);
+        } catch (...) {
+            if (node->count == 0) {
+                (node->prev != nullptr ? node->prev->next : head) = nullptr;
+                tail = node->prev;
+                destroyNode(node);
+            }
+            throw;
+        }
+    } else {
+        // Shift the elements behind index up by one; value is copied first,
+        // as it may be one of them
+        T  copy(value);
+        T* last = node->item(node->count - 1);
+        ::new (last + 1) T(std::move(*last));
+        for (size_type i = node->count - 1; i > index; --i) {
+            *node->item(i) = std::move(*node->item(i - 1));
+        }
+        *node->item(index) = std::move(copy);
+    }
+    ++node->count;
+    ++count;
+
+    return iterator(node, index);
+}
+
+#endif  // UNROLLED_LLIST_HPP
+
+// EOF: UnrolledLList.hpp
@@ -20,6 +20,7 @@
 
 // Preprocessor directives
 #include <iostream>
+#include <iterator>
 #include <string>
 #include "LList.hpp"        // Include the custom linked list template file
 
@@ -49,10 +50,14 @@ int main() {
 }
 
 /// @brief Processes the input string and populates the output linked list
+/// The numbers typed between two brackets form a segment, collected in a
+/// list of its own and spliced to the front ('[') or the back (']') of the
+/// output as a whole once the next bracket or the end of the line is read.
 /// @param input The input list to be processed
 /// @param output The processed output list
 void processInput(const std::string& input, LList<int>& output) {
-    auto currentPos = output.begin();       // Current insertion position
+    LList<int> segment;                     // Numbers of the current segment
+    bool atFront = false;   // Flag to check if the segment goes to the front
     int number = 0;                         // Current number being processed
     bool isNumber = false;    // Flag to check if a number is being processed
 
@@ -61,21 +66,16 @@ void processInput(const std::string& input, LList<int>& output) {
         if (ch == ' ') {
             // Check spaces (' ')
             if (isNumber) {
-                output.insert(currentPos, number);
+                segment.push_back(number);
                 isNumber = false;
             }
-        } else if (ch == '[') {
-            // Check for bracket ('[')
-            currentPos = output.begin();
+        } else if (ch == '[' || ch == ']') {
+            // Check for brackets ('[' or ']'): move the finished segment into
+            // place, then start a new one at the front or the back
+            output.splice(atFront ? output.begin() : output.end(), segment);
+            atFront = ch == '[';
             if (isNumber) {
-                output.insert(currentPos, number);
-                isNumber = false;
-            }
-        } else if (ch == ']') {
-            // Check for bracket (']')
-            currentPos = output.end();
-            if (isNumber) {
-                output.insert(currentPos, number);
+                segment.push_back(number);
                 isNumber = false;
             }
         } else {
@@ -89,10 +89,11 @@ void processInput(const std::string& input, LList<int>& output) {
         }
     }
 
-    // Insert the last number if present
+    // Insert the last number if present, then the last segment
     if (isNumber) {
-        output.insert(currentPos, number);
+        segment.push_back(number);
     }
+    output.splice(atFront ? output.begin() : output.end(), segment);
 }
 
 /// @brief Function prints the elements of the linked list
@@ -0,0 +1,183 @@
+/// @file ConcurrentQueue-bench.cxx
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file benchmarks ConcurrentQueue as the link between the
+/// stages of a pipeline: p producer threads push their share of n ints and c
+/// consumer threads pop them until all n are through. The queue is measured
+/// unbounded, bounded to 1024 elements, and against an LList guarded by a
+/// std::mutex, for every pair of p and c from 1 up to the number of hardware
+/// threads (doubling, and that number itself), so that fan-in (many
+/// producers, one consumer) and fan-out show apart from balanced pipelines;
+/// the report lists the throughput in millions of elements per second.
+///
+/// Example usage:
+/// @code
+///   g++ -O2 -pthread ConcurrentQueue-bench.cxx -o queue-bench
+///   ./queue-bench 100000 4    # 10^5 elements (default 10^6), p, c = 1 to 4
+/// @endcode
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "LList.hpp"
+#include "ConcurrentQueue.hpp"
+
+/// LList guarded by a std::mutex, with the interface of ConcurrentQueue
+/// that the benchmark uses.
+class LockedQueue {
+public:
+    /// Appends value to the back of the queue.
+    /// @param value The value of the element to append.
+    void push(int value) {
+        std::lock_guard<std::mutex> hold(m_lock);
+        m_list.push_back(value);
+    }
+
+    /// Moves the front element into value and removes it, unless the queue
+    /// is empty.
+    /// @param value Receives the element.
+    /// @return      True if an element was removed.
+    bool try_pop(int& value) {
+        std::lock_guard<std::mutex> hold(m_lock);
+        if (m_list.empty()) {
+            return false;
+        }
+
+        value = m_list.front();
+        m_list.pop_front();
+        return true;
+    }
+
+private:
+    LList<int> m_list;  ///< The elements
+    std::mutex m_lock;  ///< Guards m_list
+};
+
+/// Runs producers producers and consumers consumers over queue until count
+/// elements went through, and returns the throughput.
+/// @param queue     The queue to measure.
+/// @param count     The number of elements.
+/// @param producers The number of producer threads.
+/// @param consumers The number of consumer threads.
+/// @return          Millions of elements per second.
+template <class Queue>
+double runMops(Queue& queue, std::size_t count, unsigned producers,
+               unsigned consumers) {
+    std::atomic<std::size_t> popped(0);
+    std::atomic<long long>   sum(0);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < producers; ++t) {
+        workers.emplace_back([&queue, count, producers, t] {
+            for (std::size_t i = t; i < count; i += producers) {
+                queue.push(static_cast<int>(i));
+            }
+        });
+    }
+    for (unsigned t = 0; t < consumers; ++t) {
+        workers.emplace_back([&queue, &popped, &sum, count] {
+            long long local = 0;
+            int       value = 0;
+
+            while (popped.load(std::memory_order_relaxed) < count) {
+                if (queue.try_pop(value)) {
+                    local += value;
+                    popped.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            sum.fetch_add(local);
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    const std::chrono::duration<double, std::micro> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    // every element must come out exactly once
+    const long long expected =
+        static_cast<long long>(count) * (static_cast<long long>(count) - 1) / 2;
+    if (sum.load() != expected) {
+        std::cerr << "lost elements" << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    return static_cast<double>(count) / elapsed.count();
+}
+
+/// Returns the thread counts to measure: 1, 2, 4, ... below most, and most.
+/// @param most The largest thread count.
+/// @return     The thread counts, ascending.
+std::vector<unsigned> threadCounts(unsigned most) {
+    std::vector<unsigned> counts;
+    for (unsigned threads = 1; threads < most; threads *= 2) {
+        counts.push_back(threads);
+    }
+    counts.push_back(most);
+
+    return counts;
+}
+
+/// -------------------------------------------------------------------------
+/// Main entry-point for this application
+///
+/// @returns Exit-code for the process - 0 for success, else an error code.
+/// -------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    // number of elements (default 10^6)
+    const std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10)
+                                       : 1000000;
+    // most producers, and consumers (default the number of hardware threads)
+    const unsigned hardware = std::thread::hardware_concurrency();
+    const int      most = argc > 2 ? std::atoi(argv[2])
+                                   : static_cast<int>(hardware);
+    const std::vector<unsigned> counts =
+        threadCounts(most > 0 ? static_cast<unsigned>(most) : 1);
+
+    std::cout << count << " ints" << std::endl
+              << std::left
+              << std::setw(11) << "producers"
+              << std::setw(11) << "consumers"
+              << std::setw(14) << "Concurrent"
+              << std::setw(14) << "bounded 1024"
+              << std::setw(14) << "LList+mutex"
+              << "(M/s)" << std::endl;
+
+    for (unsigned producers : counts) {
+        for (unsigned consumers : counts) {
+            ConcurrentQueue<int> unbounded;
+            ConcurrentQueue<int> bounded(1024);
+            LockedQueue          locked;
+
+            const double lockFree =
+                runMops(unbounded, count, producers, consumers);
+            const double limited =
+                runMops(bounded, count, producers, consumers);
+            const double guarded =
+                runMops(locked, count, producers, consumers);
+
+            std::cout << std::left << std::fixed << std::setprecision(2)
+                      << std::setw(11) << producers
+                      << std::setw(11) << consumers
+                      << std::setw(14) << lockFree
+                      << std::setw(14) << limited
+                      << std::setw(14) << guarded << std::endl;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+// EOF: ConcurrentQueue-bench.cxx
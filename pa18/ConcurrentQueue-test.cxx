@@ -0,0 +1,164 @@
+/// @file ConcurrentQueue-test.cxx
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file contains Catch2 unit tests for the ConcurrentQueue
+/// class: FIFO order and the capacity bound on one thread, the place of a
+/// push that throws being given back, and several producers and consumers
+/// whose popped values must add up to exactly what was pushed. Build with
+/// -pthread; the tests also run clean under -fsanitize=thread.
+
+#include <atomic>
+#include <cstddef>  // provides std::size_t
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+
+#include "ConcurrentQueue.hpp"
+
+/// Fragile is an element whose constructor throws for negative values.
+struct Fragile {
+    explicit Fragile(int v) : value(v) {
+        if (v < 0) {
+            throw std::runtime_error("construction failed");
+        }
+    }
+    Fragile() : value(0) {}
+
+    int value;
+};
+
+TEST_CASE("ConcurrentQueue on one thread", "[ConcurrentQueue]") {
+    SECTION("elements come out in FIFO order") {
+        ConcurrentQueue<int> queue;
+        int value = -1;
+        CHECK(queue.empty());
+        CHECK_FALSE(queue.try_pop(value));
+
+        for (int i = 0; i < 100; ++i) {
+            CHECK(queue.try_push(i));
+        }
+        CHECK(queue.size() == 100);
+        for (int i = 0; i < 100; ++i) {
+            REQUIRE(queue.try_pop(value));
+            CHECK(value == i);
+        }
+        CHECK(queue.empty());
+    }
+
+    SECTION("a bounded queue holds at most its capacity") {
+        ConcurrentQueue<int> queue(4);
+        CHECK(queue.capacity() == 4);
+        for (int i = 0; i < 4; ++i) {
+            CHECK(queue.try_push(i));
+        }
+        CHECK_FALSE(queue.try_push(4));
+        CHECK(queue.size() == 4);
+
+        int value = -1;
+        REQUIRE(queue.try_pop(value));
+        CHECK(value == 0);
+        CHECK(queue.try_push(4));
+        CHECK_FALSE(queue.try_push(5));
+    }
+}
+
+TEST_CASE("ConcurrentQueue gives back the place of a push that throws",
+          "[ConcurrentQueue]") {
+    ConcurrentQueue<Fragile> queue(2);
+
+    for (int i = 0; i < 3; ++i) {
+        CHECK_THROWS_AS(queue.try_emplace(-1), std::runtime_error);
+        CHECK(queue.size() == 0);
+    }
+
+    // the queue still takes as many elements as its capacity
+    CHECK(queue.try_emplace(1));
+    CHECK(queue.try_emplace(2));
+    CHECK_FALSE(queue.try_emplace(3));
+
+    Fragile element;
+    REQUIRE(queue.try_pop(element));
+    CHECK(element.value == 1);
+    REQUIRE(queue.try_pop(element));
+    CHECK(element.value == 2);
+    CHECK(queue.empty());
+}
+
+/// Runs producers threads, each pushing perProducer values of its own,
+/// through a queue of the given capacity, and consumers threads that pop
+/// until all are taken. Checks that every value is popped exactly once and
+/// that the sums match.
+static void checkSums(std::size_t capacity, int producers, int consumers) {
+    const long perProducer = 20000;
+    const long total = producers * perProducer;
+
+    ConcurrentQueue<long> queue(capacity);
+    std::atomic<long> pushedSum{0};
+    std::atomic<long> poppedSum{0};
+    std::atomic<long> popped{0};
+    std::vector<std::atomic<int>> seen(total);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            long sum = 0;
+            for (long i = 0; i < perProducer; ++i) {
+                const long value = p * perProducer + i;
+                queue.push(value);
+                sum += value;
+            }
+            pushedSum += sum;
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            long sum = 0;
+            long value = 0;
+            while (popped.load() < total) {
+                if (queue.try_pop(value)) {
+                    ++popped;
+                    ++seen[value];
+                    sum += value;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            poppedSum += sum;
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    CHECK(popped == total);
+    CHECK(poppedSum == pushedSum);
+    CHECK(pushedSum == total * (total - 1) / 2);
+    CHECK(queue.empty());
+
+    long wrong = 0;
+    for (std::atomic<int>& count : seen) {
+        wrong += count != 1 ? 1 : 0;
+    }
+    CHECK(wrong == 0);
+}
+
+TEST_CASE("ConcurrentQueue with several producers and consumers",
+          "[ConcurrentQueue]") {
+    SECTION("unbounded, 2 producers and 2 consumers") {
+        checkSums(0, 2, 2);
+    }
+
+    SECTION("bounded to 64, 3 producers and 2 consumers") {
+        checkSums(64, 3, 2);
+    }
+
+    SECTION("bounded to 4, 1 producer and 3 consumers") {
+        checkSums(4, 1, 3);
+    }
+}
+
+// EOF: ConcurrentQueue-test.cxx
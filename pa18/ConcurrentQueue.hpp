@@ -0,0 +1,564 @@
+/// @file ConcurrentQueue.hpp
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file declares ConcurrentQueue, a first-in first-out queue
+/// that any number of threads can push to and pop from at the same time
+/// without locks, so that the stages of a pipeline (read, process, print)
+/// can run on threads of their own. It is the queue of Michael and Scott: a
+/// singly linked list of nodes like LList's, with a dummy node at the head,
+/// whose head and tail are swung with compare-and-swap. Nodes are freed
+/// through hazard pointers, and the queue may be bounded.
+///
+/// Example usage:
+/// @code
+///   ConcurrentQueue<std::string> lines(1024);   // at most 1024 lines
+///   // producer thread
+///   lines.push(line);                           // waits while full
+///   // consumer thread
+///   std::string line;
+///   if (lines.try_pop(line)) { std::cout << line << '\n'; }
+/// @endcode
+
+#ifndef CONCURRENT_QUEUE_HPP
+#define CONCURRENT_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>  // provides std::size_t
+#include <initializer_list>
+#include <new>      // provides placement new and std::launder
+#include <thread>   // provides std::this_thread::yield
+#include <utility>  // provides std::forward and std::move
+
+/// ConcurrentNode is a node of a ConcurrentQueue. Like LList's Node it holds
+/// one element and the link to the next node, which is atomic as threads
+/// follow and swing it concurrently. The element is constructed while the
+/// node is in the queue behind the dummy head.
+template <class T>
+struct ConcurrentNode {
+    /// Returns a pointer to the element of the node.
+    T* item() { return std::launder(reinterpret_cast<T*>(storage)); }
+
+    std::atomic<ConcurrentNode*> next{nullptr};  ///< Next node in the queue
+    ConcurrentNode* retiredNext = nullptr;  ///< Next retired or spare node
+    alignas(T) unsigned char storage[sizeof(T)];  ///< The element
+};
+
+/// ConcurrentQueue is a lock-free multi-producer multi-consumer FIFO queue.
+/// push and pop each link or unlink one node with compare-and-swap, and any
+/// thread that finds the tail lagging behind swings it forward, so no thread
+/// ever waits for another to finish its operation.
+///
+/// A popped node cannot be freed at once, as other threads may still read
+/// it. Each operation borrows a hazard record from the queue, announces the
+/// nodes it is about to read in the record's hazard pointers, and retires the
+/// nodes it unlinks to the record. Every RETIRE_BATCH retirements the record
+/// frees the retired nodes no hazard pointer announces, keeping up to
+/// SPARE_NODES of them to reuse for its next pushes.
+///
+/// A queue constructed with a capacity holds at most that many elements:
+/// try_push fails and push waits while it is full. The destructor requires
+/// that no other thread uses the queue.
+///
+/// @tparam T Type of the elements.
+template <class T>
+class ConcurrentQueue {
+public:
+    // Public aliases
+    using size_type       = std::size_t;
+    using value_type      = T;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+
+    /// Retired nodes a hazard record collects before it frees them.
+    static const size_type RETIRE_BATCH = 64;
+    /// Freed nodes a hazard record keeps for reuse.
+    static const size_type SPARE_NODES = 128;
+
+    /* Constructors and Destructor */
+
+    /// Constructs an empty queue with the dummy node.
+    /// @param capacity The most elements the queue holds, or 0 for no limit.
+    explicit ConcurrentQueue(size_type capacity = 0);
+
+    ConcurrentQueue(const ConcurrentQueue&) = delete;
+    ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+
+    /// Destructs the queue. The elements are destroyed and all nodes and
+    /// hazard records are deallocated. Not thread-safe.
+    ~ConcurrentQueue();
+
+    /* Capacity */
+
+    /// Checks if the queue has no elements.
+    /// @return True if no element is in the queue.
+    bool empty() const noexcept;
+
+    /// Returns the number of elements in the queue. With other threads at
+    /// work the value may be outdated as soon as it is returned.
+    /// @return The number of elements pushed and not popped yet.
+    size_type size() const noexcept;
+
+    /// Returns the most elements the queue holds.
+    /// @return The capacity, or 0 for an unbounded queue.
+    size_type capacity() const noexcept { return m_capacity; }
+
+    /* Modifiers */
+
+    /// Appends a copy of value to the back of the queue, unless it is full.
+    /// Safe to call from several threads at once.
+    /// @param value The value of the element to append.
+    /// @return      True if the element was appended.
+    bool try_push(const value_type& value);
+    bool try_push(value_type&& value);
+
+    /// Appends a new element constructed in place from args to the back of
+    /// the queue, unless it is full. Safe to call from several threads at
+    /// once.
+    /// @param args The arguments forwarded to the constructor of the element.
+    /// @return     True if the element was appended.
+    template <class... Args>
+    bool try_emplace(Args&&... args);
+
+    /// Appends value to the back of the queue, yielding the thread while the
+    /// queue is full. Safe to call from several threads at once.
+    /// @param value The value of the element to append.
+    void push(const value_type& value);
+    void push(value_type&& value);
+
+    /// Moves the front element into value and removes it, unless the queue is
+    /// empty. Safe to call from several threads at once.
+    /// @param value Receives the element.
+    /// @return      True if an element was removed.
+    bool try_pop(value_type& value);
+
+    /// Moves the front element into value and removes it, yielding the thread
+    /// while the queue is empty. Safe to call from several threads at once.
+    /// @param value Receives the element.
+    void pop(value_type& value);
+
+private:
+    using Node = ConcurrentNode<T>;
+
+    /// The hazard pointers of one operation and the nodes it retired. A
+    /// record is owned by one thread at a time, from the start to the end of
+    /// an operation; the records are never freed before the queue.
+    struct HazardRecord {
+        std::atomic<bool>          active{false};   ///< Owned by a thread
+        std::atomic<Node*>         hazard[2] = {};  ///< Nodes being read
+        std::atomic<HazardRecord*> next{nullptr};   ///< Next record
+        Node*     retired = nullptr;   ///< Unlinked nodes not freed yet
+        size_type retiredCount = 0;
+        Node*     spare = nullptr;     ///< Freed nodes kept for reuse
+        size_type spareCount = 0;
+    };
+
+    /// Claims a place for one more element.
+    /// @return True unless the queue is full.
+    bool reserve() noexcept;
+
+    /// Returns an inactive hazard record, now owned by the calling thread,
+    /// creating one if all are in use.
+    /// @return The record.
+    HazardRecord* acquire();
+
+    /// Clears the hazard pointers of record and gives it back.
+    /// @param record The record of the finished operation.
+    void release(HazardRecord* record) noexcept;
+
+    /// Loads source and announces the node in hazard pointer slot of record,
+    /// until the announced node is still the one in source.
+    /// @param record The record of the operation.
+    /// @param slot   The hazard pointer to use.
+    /// @param source The pointer to load.
+    /// @return       The node, safe to read until the slot is changed.
+    static Node* protect(HazardRecord* record, int slot,
+                         const std::atomic<Node*>& source) noexcept;
+
+    /// Adds an unlinked node to the retired nodes of record, freeing the
+    /// retired nodes after every RETIRE_BATCH.
+    /// @param record The record of the operation.
+    /// @param node   The node, whose element is already destroyed.
+    void retire(HazardRecord* record, Node* node) noexcept;
+
+    /// Frees the retired nodes of record that no hazard pointer announces.
+    /// @param record The record of the operation.
+    void scan(HazardRecord* record) noexcept;
+
+    /// Returns a node for a new element, a spare one of record if any.
+    /// @param record The record of the operation.
+    /// @return       The node, with its element not constructed yet.
+    static Node* createNode(HazardRecord* record);
+
+    alignas(64) std::atomic<Node*> m_head;     ///< The dummy node
+    alignas(64) std::atomic<Node*> m_tail;     ///< Last or next to last node
+    alignas(64) std::atomic<size_type> m_size; ///< Elements in the queue
+    std::atomic<HazardRecord*> m_records;      ///< List of hazard records
+    const size_type            m_capacity;     ///< Most elements, 0 for all
+};
+
+// ----------------------------------------------------------------------------
+
+/* Constructors and Destructor */
+
+/// Constructs an empty queue with the dummy node.
+/// @param capacity The most elements the queue holds, or 0 for no limit.
+template <class T>
+ConcurrentQueue<T>::ConcurrentQueue(size_type capacity)
+    : m_size(0), m_records(nullptr), m_capacity(capacity) {
+    Node* dummy = new Node;
+    m_head.store(dummy, std::memory_order_relaxed);
+    m_tail.store(dummy, std::memory_order_relaxed);
+}
+
+/// Destructs the queue. The elements are destroyed and all nodes and
+/// hazard records are deallocated. Not thread-safe.
+template <class T>
+ConcurrentQueue<T>::~ConcurrentQueue() {
+    // the dummy node holds no element, the nodes after it do
+    Node* node = m_head.load(std::memory_order_relaxed);
+    Node* next = node->next.load(std::memory_order_relaxed);
+    delete node;
+
+    for (node = next; node != nullptr; node = next) {
+        next = node->next.load(std::memory_order_relaxed);
+        node->item()->~T();
+        delete node;
+    }
+
+    HazardRecord* record = m_records.load(std::memory_order_relaxed);
+    while (record != nullptr) {
+        for (Node* list : {record->retired, record->spare}) {
+            while (list != nullptr) {
+                Node* following = list->retiredNext;
+                delete list;
+                list = following;
+            }
+        }
+
+        HazardRecord* following = record->next.load(std::memory_order_relaxed);
+        delete record;
+        record = following;
+    }
+}
+
+/* Capacity */
+
+/// Checks if the queue has no elements.
+/// @return True if no element is in the queue.
+template <class T>
+bool ConcurrentQueue<T>::empty() const noexcept {
+    return size() == 0;
+}
+
+/// Returns the number of elements in the queue. With other threads at
+/// work the value may be outdated as soon as it is returned.
+/// @return The number of elements pushed and not popped yet.
+template <class T>
+typename ConcurrentQueue<T>::size_type
+ConcurrentQueue<T>::size() const noexcept {
+    return m_size.load(std::memory_order_acquire);
+}
+
+/* Modifiers */
+
+/// Appends a copy of value to the back of the queue, unless it is full.
+/// Safe to call from several threads at once.
+/// @param value The value of the element to append.
+/// @return      True if the element was appended.
+template <class T>
+bool ConcurrentQueue<T>::try_push(const value_type& value) {
+    return try_emplace(value);
+}
+
+template <class T>
+bool ConcurrentQueue<T>::try_push(value_type&& value) {
+    return try_emplace(std::move(value));
+}
+
+/// Appends a new element constructed in place from args to the back of
+/// the queue, unless it is full. Safe to call from several threads at
+/// once.
+/// @param args The arguments forwarded to the constructor of the element.
+/// @return     True if the element was appended.
+template <class T>
+template <class... Args>
+bool ConcurrentQueue<T>::try_emplace(Args&&... args) {
+    if (!reserve()) {
+        return false;
+    }
+
+    HazardRecord* record = nullptr;
+    Node*         node   = nullptr;
+
+    try {
+        // every step may throw: give the reserved place back if one does
+        record = acquire();
+        node = createNode(record);
+        ::new (static_cast<void*>(node->storage))
+            T(std::forward<Args>(args)...);
+    } catch (...) {
+        delete node;
+        if (record != nullptr) {
+            release(record);
+        }
+        m_size.fetch_sub(1, std::memory_order_acq_rel);
+        throw;
+    }
+
+    // link the node after the last one, then swing the tail to it
+    for (;;) {
+        Node* tail = protect(record, 0, m_tail);
+        Node* next = tail->next.load();
+
+        if (next == nullptr) {
+            if (tail->next.compare_exchange_weak(next, node)) {
+                m_tail.compare_exchange_strong(tail, node);
+                break;
+            }
+        } else {
+            // another push linked a node, help it along
+            m_tail.compare_exchange_strong(tail, next);
+        }
+    }
+
+    release(record);
+    return true;
+}
+
+/// Appends value to the back of the queue, yielding the thread while the
+/// queue is full. Safe to call from several threads at once.
+/// @param value The value of the element to append.
+template <class T>
+void ConcurrentQueue<T>::push(const value_type& value) {
+    while (!try_emplace(value)) {
+        std::this_thread::yield();
+    }
+}
+
+template <class T>
+void ConcurrentQueue<T>::push(value_type&& value) {
+    // a failed try_emplace does not touch value
+    while (!try_emplace(std::move(value))) {
+        std::this_thread::yield();
+    }
+}
+
+/// Moves the front element into value and removes it, unless the queue is
+/// empty. Safe to call from several threads at once.
+/// @param value Receives the element.
+/// @return      True if an element was removed.
+template <class T>
+bool ConcurrentQueue<T>::try_pop(value_type& value) {
+    HazardRecord* record = acquire();
+
+    for (;;) {
+        Node* head = protect(record, 0, m_head);
+        Node* tail = m_tail.load();
+        Node* next = head->next.load();
+
+        // announce next, then make sure it was not popped meanwhile
+        record->hazard[1].store(next);
+        if (head != m_head.load()) {
+            continue;
+        }
+
+        if (next == nullptr) {
+            release(record);
+            return false;
+        }
+
+        if (head == tail) {
+            // the tail lags behind a push, help it along
+            m_tail.compare_exchange_strong(tail, next);
+            continue;
+        }
+
+        // next becomes the dummy; only the winner touches its element
+        if (m_head.compare_exchange_strong(head, next)) {
+            m_size.fetch_sub(1, std::memory_order_acq_rel);
+
+            try {
+                value = std::move(*next->item());
+            } catch (...) {
+                next->item()->~T();
+                record->hazard[0].store(nullptr, std::memory_order_release);
+                retire(record, head);
+                release(record);
+                throw;
+            }
+            next->item()->~T();
+
+            // no longer read here, head may be freed at once
+            record->hazard[0].store(nullptr, std::memory_order_release);
+            retire(record, head);
+            release(record);
+            return true;
+        }
+    }
+}
+
+/// Moves the front element into value and removes it, yielding the thread
+/// while the queue is empty. Safe to call from several threads at once.
+/// @param value Receives the element.
+template <class T>
+void ConcurrentQueue<T>::pop(value_type& value) {
+    while (!try_pop(value)) {
+        std::this_thread::yield();
+    }
+}
+
+/* Hazard Pointers */
+
+/// Claims a place for one more element.
+/// @return True unless the queue is full.
+template <class T>
+bool ConcurrentQueue<T>::reserve() noexcept {
+    if (m_capacity == 0) {
+        m_size.fetch_add(1, std::memory_order_acq_rel);
+        return true;
+    }
+
+    size_type count = m_size.load(std::memory_order_relaxed);
+    do {
+        if (count >= m_capacity) {
+            return false;
+        }
+    } while (!m_size.compare_exchange_weak(count, count + 1,
+                                           std::memory_order_acq_rel,
+                                           std::memory_order_relaxed));
+
+    return true;
+}
+
+/// Returns an inactive hazard record, now owned by the calling thread,
+/// creating one if all are in use.
+/// @return The record.
+template <class T>
+typename ConcurrentQueue<T>::HazardRecord* ConcurrentQueue<T>::acquire() {
+    for (HazardRecord* record = m_records.load(std::memory_order_acquire);
+         record != nullptr;
+         record = record->next.load(std::memory_order_acquire)) {
+        if (!record->active.load(std::memory_order_relaxed) &&
+            !record->active.exchange(true, std::memory_order_acquire)) {
+            return record;
+        }
+    }
+
+    // all records are in use, add one at the front of the list
+    HazardRecord* record = new HazardRecord;
+    record->active.store(true, std::memory_order_relaxed);
+
+    HazardRecord* first = m_records.load(std::memory_order_relaxed);
+    do {
+        record->next.store(first, std::memory_order_relaxed);
+    } while (!m_records.compare_exchange_weak(first, record,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed));
+
+    return record;
+}
+
+/// Clears the hazard pointers of record and gives it back.
+/// @param record The record of the finished operation.
+template <class T>
+void ConcurrentQueue<T>::release(HazardRecord* record) noexcept {
+    record->hazard[0].store(nullptr, std::memory_order_release);
+    record->hazard[1].store(nullptr, std::memory_order_release);
+    record->active.store(false, std::memory_order_release);
+}
+
+/// Loads source and announces the node in hazard pointer slot of record,
+/// until the announced node is still the one in source.
+/// @param record The record of the operation.
+/// @param slot   The hazard pointer to use.
+/// @param source The pointer to load.
+/// @return       The node, safe to read until the slot is changed.
+template <class T>
+typename ConcurrentQueue<T>::Node*
+ConcurrentQueue<T>::protect(HazardRecord* record, int slot,
+                            const std::atomic<Node*>& source) noexcept {
+    // sequentially consistent, so that scan() sees the announcement or this
+    // thread sees the node unlinked
+    Node* node = source.load();
+    for (;;) {
+        record->hazard[slot].store(node);
+
+        Node* again = source.load();
+        if (again == node) {
+            return node;
+        }
+        node = again;
+    }
+}
+
+/// Adds an unlinked node to the retired nodes of record, freeing the
+/// retired nodes after every RETIRE_BATCH.
+/// @param record The record of the operation.
+/// @param node   The node, whose element is already destroyed.
+template <class T>
+void ConcurrentQueue<T>::retire(HazardRecord* record, Node* node) noexcept {
+    node->retiredNext = record->retired;
+    record->retired = node;
+
+    if (++record->retiredCount >= RETIRE_BATCH) {
+        scan(record);
+    }
+}
+
+/// Frees the retired nodes of record that no hazard pointer announces.
+/// @param record The record of the operation.
+template <class T>
+void ConcurrentQueue<T>::scan(HazardRecord* record) noexcept {
+    Node* node = record->retired;
+    record->retired = nullptr;
+    record->retiredCount = 0;
+
+    while (node != nullptr) {
+        Node* following = node->retiredNext;
+
+        bool hazardous = false;
+        for (HazardRecord* other = m_records.load();
+             other != nullptr && !hazardous; other = other->next.load()) {
+            hazardous = other->hazard[0].load() == node ||
+                        other->hazard[1].load() == node;
+        }
+
+        if (hazardous) {
+            node->retiredNext = record->retired;
+            record->retired = node;
+            ++record->retiredCount;
+        } else if (record->spareCount < SPARE_NODES) {
+            node->retiredNext = record->spare;
+            record->spare = node;
+            ++record->spareCount;
+        } else {
+            delete node;
+        }
+
+        node = following;
+    }
+}
+
+/// Returns a node for a new element, a spare one of record if any.
+/// @param record The record of the operation.
+/// @return       The node, with its element not constructed yet.
+template <class T>
+typename ConcurrentQueue<T>::Node*
+ConcurrentQueue<T>::createNode(HazardRecord* record) {
+    Node* node = record->spare;
+
+    if (node == nullptr) {
+        return new Node;
+    }
+
+    record->spare = node->retiredNext;
+    --record->spareCount;
+
+    node->next.store(nullptr, std::memory_order_relaxed);
+    return node;
+}
+
+#endif  // CONCURRENT_QUEUE_HPP
+
+// EOF: ConcurrentQueue.hpp
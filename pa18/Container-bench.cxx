@@ -0,0 +1,52 @@
+/// @file Container-bench.cxx
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file benchmarks the LList and Stack templates against
+/// std::list and std::stack with the shared harness in Bench.hpp. The lists
+/// are measured on push_back, insert and erase in the middle, iteration,
+/// copy and move, the stacks on push, top and pop, copy and move, for int,
+/// std::string and 64-byte record elements and 10^2 up to 10^max elements
+/// (default 10^4). The results are written to the standard output as CSV
+/// (default) or JSON, so that the output of two revisions can be compared.
+///
+/// Example usage:
+/// @code
+///   g++ -O2 Container-bench.cxx -o container-bench
+///   ./container-bench json 6 > container-bench.json
+/// @endcode
+
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <stack>
+#include <string>
+
+#include "LList.hpp"
+#include "Stack.hpp"
+#include "Bench.hpp"
+
+/// -------------------------------------------------------------------------
+/// Main entry-point for this application
+///
+/// @returns Exit-code for the process - 0 for success, else an error code.
+/// -------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    // output format (csv or json) and largest power of ten (default 10^4)
+    const std::string format = argc > 1 ? argv[1] : "csv";
+    const int maxExp = argc > 2 ? std::atoi(argv[2]) : 4;
+
+    benchSettleHeap();
+
+    BenchReport report;
+    benchSequence<LList>(report, "LList", maxExp);
+    benchSequence<std::list>(report, "std::list", maxExp);
+    benchStack<Stack>(report, "Stack", maxExp);
+    benchStack<std::stack>(report, "std::stack", maxExp);
+
+    report.write(std::cout, format);
+
+    return EXIT_SUCCESS;
+}
+
+// EOF: Container-bench.cxx
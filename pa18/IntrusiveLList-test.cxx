@@ -0,0 +1,314 @@
+/// @file IntrusiveLList-test.cxx
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file contains Catch2 unit tests for the ListHook struct and
+/// the IntrusiveLList class: linking and unlinking elements, the errors for
+/// unlinked elements and the end iterator, objects in several lists through
+/// hooks of different tags, and elements moving between queues by splice(),
+/// move and swap.
+
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+
+#include "IntrusiveLList.hpp"
+#include "IntrusiveLList.hpp"  // test include guard
+
+/// Tag of the hook linking a Job into a ready queue.
+struct Ready {};
+
+/// Job is in the list of all jobs through ListHook<> and in at most one
+/// ready queue through ListHook<Ready>.
+struct Job : ListHook<>, ListHook<Ready> {
+    explicit Job(int number = 0) : id(number) {}
+    int id;
+};
+
+using AllJobs = IntrusiveLList<Job>;
+using ReadyQueue = IntrusiveLList<Job, ListHook<Ready>>;
+
+/// Returns the ids of the elements of list, front to back.
+template <class List>
+static std::vector<int> ids(List& list) {
+    std::vector<int> result;
+    for (Job& job : list) {
+        result.push_back(job.id);
+    }
+    return result;
+}
+
+/// Returns the ids of the elements of list, back to front.
+template <class List>
+static std::vector<int> idsBackward(List& list) {
+    std::vector<int> result;
+    for (auto it = list.end(); it != list.begin();) {
+        --it;
+        result.push_back(it->id);
+    }
+    return result;
+}
+
+// Test linking and unlinking
+TEST_CASE("IntrusiveLList links and unlinks elements", "[IntrusiveLList]") {
+    Job jobs[4] = {Job(0), Job(1), Job(2), Job(3)};
+    AllJobs all;
+
+    SECTION("empty list") {
+        CHECK(all.empty());
+        CHECK(all.size() == 0);
+        CHECK(all.begin() == all.end());
+        CHECK_THROWS_AS(all.front(), std::out_of_range);
+        CHECK_THROWS_AS(all.back(), std::out_of_range);
+        all.pop_front();
+        all.pop_back();
+        CHECK(all.empty());
+    }
+
+    SECTION("push, pop and iterate both ways") {
+        all.push_back(jobs[1]);
+        all.push_back(jobs[2]);
+        all.push_front(jobs[0]);
+        CHECK(all.size() == 3);
+        CHECK(all.front().id == 0);
+        CHECK(all.back().id == 2);
+        CHECK(ids(all) == std::vector<int>{0, 1, 2});
+        CHECK(idsBackward(all) == std::vector<int>{2, 1, 0});
+
+        all.pop_front();
+        all.pop_back();
+        CHECK(ids(all) == std::vector<int>{1});
+        CHECK_FALSE(static_cast<ListHook<>&>(jobs[0]).is_linked());
+        CHECK_FALSE(static_cast<ListHook<>&>(jobs[2]).is_linked());
+    }
+
+    SECTION("insert and erase in the middle") {
+        all.push_back(jobs[0]);
+        all.push_back(jobs[3]);
+        auto it = all.insert(all.iterator_to(jobs[3]), jobs[1]);
+        CHECK(it->id == 1);
+        all.insert(all.end(), jobs[2]);
+        CHECK(ids(all) == std::vector<int>{0, 1, 3, 2});
+
+        it = all.erase(all.iterator_to(jobs[3]));
+        CHECK(it->id == 2);
+        it = all.erase(it);
+        CHECK(it == all.end());
+        CHECK(ids(all) == std::vector<int>{0, 1});
+        CHECK(all.size() == 2);
+    }
+
+    SECTION("remove in constant time") {
+        for (Job& job : jobs) {
+            all.push_back(job);
+        }
+        all.remove(jobs[2]);
+        all.remove(jobs[0]);
+        CHECK(ids(all) == std::vector<int>{1, 3});
+        CHECK(all.size() == 2);
+    }
+
+    SECTION("destroying or clearing the list unlinks its elements") {
+        {
+            AllJobs scoped;
+            scoped.push_back(jobs[0]);
+            scoped.push_back(jobs[1]);
+        }
+        CHECK_FALSE(static_cast<ListHook<>&>(jobs[0]).is_linked());
+
+        all.push_back(jobs[0]);
+        all.push_back(jobs[1]);
+        all.clear();
+        CHECK(all.empty());
+        CHECK_FALSE(static_cast<ListHook<>&>(jobs[1]).is_linked());
+        all.push_back(jobs[1]);
+        CHECK(ids(all) == std::vector<int>{1});
+    }
+
+    SECTION("copying an element does not copy its membership") {
+        all.push_back(jobs[0]);
+        Job copy(jobs[0]);
+        CHECK_FALSE(static_cast<ListHook<>&>(copy).is_linked());
+        all.push_back(copy);
+        CHECK(all.size() == 2);
+        all.remove(copy);
+    }
+}
+
+// Test the errors
+TEST_CASE("IntrusiveLList rejects unlinked elements and end()",
+          "[IntrusiveLList]") {
+    Job jobs[2] = {Job(0), Job(1)};
+    AllJobs all;
+    all.push_back(jobs[0]);
+
+    SECTION("remove() and erase() of an unlinked element throw") {
+        CHECK_THROWS_AS(all.remove(jobs[1]), std::invalid_argument);
+        CHECK_THROWS_AS(all.erase(all.iterator_to(jobs[1])),
+                        std::invalid_argument);
+        CHECK(all.size() == 1);
+        CHECK(ids(all) == std::vector<int>{0});
+    }
+
+    SECTION("erase() of end() or a null iterator throws") {
+        CHECK_THROWS_AS(all.erase(all.end()), std::invalid_argument);
+        CHECK_THROWS_AS(all.erase(AllJobs::iterator()), std::invalid_argument);
+        CHECK(all.size() == 1);
+    }
+
+    SECTION("inserting a linked element throws") {
+        CHECK_THROWS_AS(all.push_back(jobs[0]), std::invalid_argument);
+        CHECK_THROWS_AS(all.insert(AllJobs::iterator(), jobs[1]),
+                        std::invalid_argument);
+        CHECK(all.size() == 1);
+        CHECK_FALSE(static_cast<ListHook<>&>(jobs[1]).is_linked());
+    }
+
+    SECTION("dereferencing end() or a null iterator throws") {
+        CHECK_THROWS_AS(*all.end(), std::runtime_error);
+        CHECK_THROWS_AS(all.end()->id, std::runtime_error);
+        CHECK_THROWS_AS(*std::next(all.begin()), std::runtime_error);
+        CHECK_THROWS_AS(*AllJobs::iterator(), std::runtime_error);
+        CHECK_THROWS_AS(++AllJobs::iterator(), std::runtime_error);
+
+        const AllJobs& view = all;
+        CHECK_THROWS_AS(*view.end(), std::runtime_error);
+        CHECK((*view.begin()).id == 0);
+    }
+}
+
+// Test objects in several lists
+TEST_CASE("IntrusiveLList links an object into lists of different hooks",
+          "[IntrusiveLList]") {
+    Job jobs[4] = {Job(0), Job(1), Job(2), Job(3)};
+    AllJobs all;
+    ReadyQueue ready;
+    for (Job& job : jobs) {
+        all.push_back(job);
+    }
+    ready.push_back(jobs[3]);
+    ready.push_back(jobs[1]);
+
+    CHECK(ids(all) == std::vector<int>{0, 1, 2, 3});
+    CHECK(ids(ready) == std::vector<int>{3, 1});
+
+    SECTION("removing from one list keeps the other") {
+        ready.remove(jobs[3]);
+        CHECK(ids(ready) == std::vector<int>{1});
+        CHECK(ids(all) == std::vector<int>{0, 1, 2, 3});
+        CHECK(static_cast<ListHook<>&>(jobs[3]).is_linked());
+        CHECK_FALSE(static_cast<ListHook<Ready>&>(jobs[3]).is_linked());
+
+        all.remove(jobs[1]);
+        CHECK(ids(all) == std::vector<int>{0, 2, 3});
+        CHECK(ids(ready) == std::vector<int>{1});
+    }
+
+    SECTION("an element in one list is unlinked for the other hook") {
+        CHECK_THROWS_AS(ready.remove(jobs[0]), std::invalid_argument);
+        CHECK(ready.size() == 2);
+        CHECK(all.size() == 4);
+    }
+
+    SECTION("clearing one list keeps the other") {
+        all.clear();
+        CHECK(ids(ready) == std::vector<int>{3, 1});
+        ready.pop_front();
+        CHECK(ids(ready) == std::vector<int>{1});
+    }
+}
+
+// Test moving elements between queues
+TEST_CASE("IntrusiveLList moves elements between queues", "[IntrusiveLList]") {
+    Job jobs[5] = {Job(0), Job(1), Job(2), Job(3), Job(4)};
+    ReadyQueue high;
+    ReadyQueue low;
+    for (int i = 0; i < 3; ++i) {
+        high.push_back(jobs[i]);
+    }
+    low.push_back(jobs[3]);
+    low.push_back(jobs[4]);
+
+    SECTION("splice one element to another queue") {
+        low.splice(low.begin(), high, high.iterator_to(jobs[1]));
+        CHECK(ids(high) == std::vector<int>{0, 2});
+        CHECK(ids(low) == std::vector<int>{1, 3, 4});
+        CHECK(high.size() == 2);
+        CHECK(low.size() == 3);
+        CHECK(idsBackward(low) == std::vector<int>{4, 3, 1});
+    }
+
+    SECTION("splice one element within a queue") {
+        high.splice(high.begin(), high, high.iterator_to(jobs[2]));
+        CHECK(ids(high) == std::vector<int>{2, 0, 1});
+        high.splice(high.end(), high, high.begin());
+        CHECK(ids(high) == std::vector<int>{0, 1, 2});
+        high.splice(high.begin(), high, high.begin());
+        CHECK(ids(high) == std::vector<int>{0, 1, 2});
+        CHECK(high.size() == 3);
+    }
+
+    SECTION("splice of end() or an unlinked element changes nothing") {
+        Job idle(9);
+        CHECK_THROWS_AS(low.splice(low.end(), high, high.end()),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(low.splice(low.end(), high, high.iterator_to(idle)),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(low.splice(ReadyQueue::iterator(), high, high.begin()),
+                        std::invalid_argument);
+        CHECK(ids(high) == std::vector<int>{0, 1, 2});
+        CHECK(ids(low) == std::vector<int>{3, 4});
+    }
+
+    SECTION("splice a whole queue") {
+        low.splice(std::next(low.begin()), high);
+        CHECK(high.empty());
+        CHECK(high.size() == 0);
+        CHECK(ids(low) == std::vector<int>{3, 0, 1, 2, 4});
+        CHECK(idsBackward(low) == std::vector<int>{4, 2, 1, 0, 3});
+        CHECK(low.size() == 5);
+
+        low.splice(low.begin(), high);
+        CHECK(low.size() == 5);
+    }
+
+    SECTION("move construct and move assign") {
+        ReadyQueue moved(std::move(high));
+        CHECK(high.empty());
+        CHECK(ids(moved) == std::vector<int>{0, 1, 2});
+        CHECK(idsBackward(moved) == std::vector<int>{2, 1, 0});
+
+        // the elements now link to the root of moved
+        moved.pop_back();
+        moved.push_back(jobs[2]);
+        CHECK(ids(moved) == std::vector<int>{0, 1, 2});
+
+        low = std::move(moved);
+        CHECK(moved.empty());
+        CHECK_FALSE(static_cast<ListHook<Ready>&>(jobs[3]).is_linked());
+        CHECK(ids(low) == std::vector<int>{0, 1, 2});
+        CHECK(low.size() == 3);
+
+        static_assert(std::is_nothrow_move_constructible<ReadyQueue>::value,
+                      "moving a queue must not throw");
+    }
+
+    SECTION("swap") {
+        high.swap(low);
+        CHECK(ids(high) == std::vector<int>{3, 4});
+        CHECK(ids(low) == std::vector<int>{0, 1, 2});
+        CHECK(high.size() == 2);
+        CHECK(low.size() == 3);
+
+        ReadyQueue empty;
+        empty.swap(low);
+        CHECK(low.empty());
+        CHECK(idsBackward(empty) == std::vector<int>{2, 1, 0});
+    }
+}
+
+// EOF: IntrusiveLList-test.cxx
@@ -0,0 +1,539 @@
+/// @file IntrusiveLList.hpp
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This header file contains the class "IntrusiveLList", a doubly
+/// linked list of objects that carry their own links. An element type
+/// derives from ListHook, which holds the prev and next pointers, so the
+/// list links the objects themselves: it never allocates, copies or owns an
+/// element, and an element is unlinked in constant time from wherever it
+/// is. An object may be in several lists at once through hooks of different
+/// tags. The interface follows LList (push_*, pop_*, insert, erase and a
+/// bidirectional iterator), taking the elements by reference.
+///
+/// Example usage:
+/// @code
+///   struct Ready {};
+///   struct Job : ListHook<>, ListHook<Ready> { int id; };
+///
+///   Job jobs[2] = {};
+///   IntrusiveLList<Job> all;                      // through ListHook<>
+///   IntrusiveLList<Job, ListHook<Ready>> ready;   // through ListHook<Ready>
+///   all.push_back(jobs[0]);
+///   all.push_back(jobs[1]);
+///   ready.push_back(jobs[1]);
+///   ready.remove(jobs[1]);                        // O(1), no deallocation
+/// @endcode
+
+// Definitions
+#ifndef INTRUSIVE_LLIST_HPP
+#define INTRUSIVE_LLIST_HPP
+
+// Preprocessor Directive(s)
+#include <cstddef>  // provides std::size_t
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+/* ========================================================================== */
+/* ========== Class/Struct Definition(s) ========= */
+/* ========================================================================== */
+/// ListHook holds the links of an object in one IntrusiveLList. An element
+/// type derives from one ListHook per list it can be in at the same time,
+/// distinguished by Tag. A hook is unlinked (null links) while its object is
+/// in no list; copying an object does not copy its memberships.
+///
+/// @tparam Tag Any type, naming the list the hook belongs to.
+template <class Tag = void>
+struct ListHook {
+    ListHook() noexcept : prev(nullptr), next(nullptr) {}
+    ListHook(const ListHook&) noexcept : prev(nullptr), next(nullptr) {}
+    ListHook& operator=(const ListHook&) noexcept { return *this; }
+
+    /// Returns true if the object is in a list through this hook.
+    bool is_linked() const noexcept { return next != nullptr; }
+
+    ListHook* prev;  ///< Hook of the previous object, or the list's root
+    ListHook* next;  ///< Hook of the next object, or the list's root
+};  // End: struct ListHook
+
+
+/// IntrusiveLList is a doubly-linked list of objects of type T linked
+/// through their Hook base. The links form a ring through a root hook kept
+/// in the list, so inserting and unlinking never test for the ends. The list
+/// only refers to its elements: they must outlive their membership, and
+/// destroying or clearing the list unlinks them without destroying them.
+///
+/// @tparam T    Type of the elements, derived from Hook.
+/// @tparam Hook The ListHook that links the elements of this list.
+template <class T, class Hook = ListHook<>>
+class IntrusiveLList {
+    static_assert(std::is_base_of<Hook, T>::value,
+                  "the element type must derive from the hook");
+
+public:
+    /// The BiDirectionalIterator struct iterates over the elements of an
+    /// IntrusiveLList in both directions. It designates an element by its
+    /// hook; the end iterator designates the root of the list, which every
+    /// iterator remembers. Like LList's iterator, it throws when a null
+    /// iterator is used or the end iterator is dereferenced.
+    struct BiDirectionalIterator {
+        // Iterator traits
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        /// Constructor: BiDirectionalIterator
+        /// Designates the element linked by hook ptr in the list rooted at
+        /// anchor, or nothing (default).
+        explicit BiDirectionalIterator(Hook* ptr = nullptr,
+                                       const Hook* anchor = nullptr)
+        : current(ptr), root(anchor) {};
+
+        // Dereference operators
+        reference operator*() const;
+        pointer operator->() const { return &**this; }
+
+        // Increment/decrement operators
+        BiDirectionalIterator& operator++();
+        BiDirectionalIterator operator++(int ignored);
+        BiDirectionalIterator& operator--();
+        BiDirectionalIterator operator--(int ignored);
+
+        // Equality/Inequality comparison operators
+        /// Checks if two iterators are/not designating the same element.
+        bool operator==(const BiDirectionalIterator& other) const
+        { return current == other.current; }
+        bool operator!=(const BiDirectionalIterator& other) const
+        { return current != other.current; }
+
+        Hook*       current;  ///< Hook of the designated element
+        const Hook* root;     ///< Root of the list, designated by end()
+    };  // End: struct BiDirectionalIterator
+
+    // types
+    using value_type = T;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = BiDirectionalIterator;
+    using const_iterator = const iterator;
+
+    // construct/copy/destroy
+    /// Constructor: IntrusiveLList
+    /// Initializes an empty list, its root linked to itself.
+    IntrusiveLList() noexcept : count(0) { root.prev = root.next = &root; }
+    IntrusiveLList(IntrusiveLList&& other) noexcept;
+    IntrusiveLList(const IntrusiveLList&) = delete;
+    virtual ~IntrusiveLList() { clear(); }
+
+    // assignment
+    IntrusiveLList& operator=(IntrusiveLList&& other) noexcept;
+    IntrusiveLList& operator=(const IntrusiveLList&) = delete;
+
+    // iterators
+    /// Returns an iterator pointing to the first element / past the last.
+    iterator       begin() noexcept { return iterator(root.next, &root); }
+    const_iterator begin() const noexcept {
+        return iterator(root.next, &root);
+    }
+    iterator       end() noexcept { return iterator(&root, &root); }
+    const_iterator end() const noexcept {
+        return iterator(rootHook(), &root);
+    }
+
+    /// Returns an iterator pointing to value, which must be in the list.
+    iterator iterator_to(T& value) noexcept {
+        return iterator(static_cast<Hook*>(&value), &root);
+    }
+
+    // capacity
+    /// Returns true if the list is empty, otherwise false, and the number of
+    /// elements in the list.
+    bool empty() const noexcept { return root.next == &root; }
+    size_type size() const noexcept { return count; }
+
+    // element access
+    reference       front();
+    const_reference front() const;
+    reference       back();
+    const_reference back() const;
+
+    // modifiers
+    void     push_front(T& value);
+    void     pop_front();
+    void     push_back(T& value);
+    void     pop_back();
+    iterator insert(const_iterator position, T& value);
+    iterator erase(const_iterator position);
+    void     remove(T& value);
+    void     swap(IntrusiveLList& other) noexcept;
+    void     clear() noexcept;
+
+    // operations
+    void splice(const_iterator position, IntrusiveLList& other,
+                const_iterator it);
+    void splice(const_iterator position, IntrusiveLList& other);
+
+private:
+    /// Returns the root hook; end() const needs it without const.
+    Hook* rootHook() const noexcept { return const_cast<Hook*>(&root); }
+
+    static void link(Hook* position, Hook* hook) noexcept;
+    static void unlink(Hook* hook) noexcept;
+    void        adopt(IntrusiveLList& other) noexcept;
+
+    Hook      root;   ///< Ring anchor: next is the first, prev the last hook
+    size_type count;
+};  // End: class IntrusiveLList
+
+
+/* ========================================================================== */
+/* ========== Function Implementations ========== */
+/* ========================================================================== */
+
+/* ========== Constructor/Move: IntrusiveLList ========== */
+/// Move: IntrusiveLList
+/// Takes over the elements of other, leaving other empty. The first and last
+/// elements are relinked to the root of this list.
+template <class T, class Hook>
+IntrusiveLList<T, Hook>::IntrusiveLList(IntrusiveLList&& other) noexcept
+    : count(0) {
+    root.prev = root.next = &root;
+    adopt(other);
+}
+
+/// Operator=(IntrusiveLList&& other): IntrusiveLList
+/// Unlinks the elements of the list, then takes over those of other.
+template <class T, class Hook>
+IntrusiveLList<T, Hook>& IntrusiveLList<T, Hook>::operator=(
+                                        IntrusiveLList&& other) noexcept {
+    if (this != &other) {
+        clear();
+        adopt(other);
+    }
+
+    return *this;
+}
+
+/* ======== Dereference/Increment Operators: BiDirectionalIterator ======== */
+/// Reference Operator*(): BiDirectionalIterator
+/// Returns the element linked by the current hook. The root of the list is
+/// no element, so the end iterator throws like a null one.
+template <class T, class Hook>
+typename IntrusiveLList<T, Hook>::BiDirectionalIterator::reference
+         IntrusiveLList<T, Hook>::BiDirectionalIterator::operator*() const {
+    // Verify current is not a nullptr nor the root
+    if (current == nullptr) {
+        throw std::runtime_error("Dereferencing a null iterator");
+    }
+    if (current == root) {
+        throw std::runtime_error("Dereferencing the end iterator");
+    }
+
+    return static_cast<T&>(*current);
+}
+
+/// Operator++(): BiDirectionalIterator&
+/// Prefix increment. Advances the iterator to the next element.
+template <class T, class Hook>
+typename IntrusiveLList<T, Hook>::BiDirectionalIterator&
+         IntrusiveLList<T, Hook>::BiDirectionalIterator::operator++() {
+    if (current == nullptr) {
+        throw std::runtime_error("Error: Attempt to increment null iterator.");
+    }
+
+    current = static_cast<Hook*>(current->next);
+    return *this;
+}
+
+/// Operator++(int ignored): BiDirectionalIterator
+/// Postfix increment. Advances the iterator but returns it as it was before.
+template <class T, class Hook>
+typename IntrusiveLList<T, Hook>::BiDirectionalIterator
+         IntrusiveLList<T, Hook>::BiDirectionalIterator::operator++(int) {
+    BiDirectionalIterator copy = *this;
+
+    operator++();
+    return copy;
+}
+
+/// Operator--(): BiDirectionalIterator&
+/// Prefix decrement. Moves the iterator to the previous element; end()
+/// moves to the last element.
+template <class T, class Hook>
+typename IntrusiveLList<T, Hook>::BiDirectionalIterator&
+         IntrusiveLList<T, Hook>::BiDirectionalIterator::operator--() {
+    if (current == nullptr) {
+        throw std::runtime_error("Error: Attempt to decrement null iterator.");
+    }
+
+    current = static_cast<Hook*>(current->prev);
+    return *this;
+}
+
+/// Operator--(int ignored): BiDirectionalIterator
+/// Postfix decrement. Moves the iterator back but returns it as it was
+/// before.
+template <class T, class Hook>
+typename IntrusiveLList<T, Hook>::BiDirectionalIterator
+         IntrusiveLList<T, Hook>::BiDirectionalIterator::operator--(int) {
+    BiDirectionalIterator copy = *this;
+
+    operator--();
+    return copy;
+}
+
+/* ========== Element Access: IntrusiveLList ========== */
+/// Reference front(): IntrusiveLList
+/// Returns a reference to the first element in the list.
+template <class T, class Hook>
+typename IntrusiveLList<T, Hook>::reference IntrusiveLList<T, Hook>::front() {
+    if (empty()) {
+        throw std::out_of_range("Accessing front on an empty list");
+    }
+
+    return static_cast<T&>(*static_cast<Hook*>(root.next));
+}
+
+/// Const_reference front() const: IntrusiveLList
+/// Returns a reference to the first element in the list.
+template <class T, class Hook>
+typename IntrusiveLList<T, Hook>::const_reference
+         IntrusiveLList<T, Hook>::front() const {
+    if (empty()) {
+        throw std::out_of_range("Accessing front on an empty list");
+    }
+
+    return static_cast<const T&>(*static_cast<const Hook*>(root.next));
+}
+
+/// Reference back(): IntrusiveLList
+/// Returns a reference to the last element in the list.
+template <class T, class Hook>
+typename IntrusiveLList<T, Hook>::reference IntrusiveLList<T, Hook>::back() {
+    if (empty()) {
+        throw std::out_of_range("Accessing back on an empty list");
+    }
+
+    return static_cast<T&>(*static_cast<Hook*>(root.prev));
+}
+
+/// Const_reference back() const: IntrusiveLList
+/// Returns a reference to the last element in the list.
+template <class T, class Hook>
+typename IntrusiveLList<T, Hook>::const_reference
+         IntrusiveLList<T, Hook>::back() const {
+    if (empty()) {
+        throw std::out_of_range("Accessing back on an empty list");
+    }
+
+    return static_cast<const T&>(*static_cast<const Hook*>(root.prev));
+}
+
+/* ========== Modifiers: IntrusiveLList ========== */
+/// Void push_front(T& value): IntrusiveLList
+/// Links value at the front of the list.
+template <class T, class Hook>
+void IntrusiveLList<T, Hook>::push_front(T& value) {
+    insert(begin(), value);
+}
+
+/// Void pop_front(): IntrusiveLList
+/// Unlinks the first element of the list, if any.
+template <class T, class Hook>
+void IntrusiveLList<T, Hook>::pop_front() {
+    if (!empty()) {
+        erase(begin());
+    }
+}
+
+/// Void push_back(T& value): IntrusiveLList
+/// Links value at the end of the list.
+template <class T, class Hook>
+void IntrusiveLList<T, Hook>::push_back(T& value) {
+    insert(end(), value);
+}
+
+/// Void pop_back(): IntrusiveLList
+/// Unlinks the last element of the list, if any.
+template <class T, class Hook>
+void IntrusiveLList<T, Hook>::pop_back() {
+    if (!empty()) {
+        erase(iterator(static_cast<Hook*>(root.prev), &root));
+    }
+}
+
+/// Iterator insert(const_iterator position, T& value): IntrusiveLList
+/// Links value before the element at position. value must not be in a list
+/// through Hook yet.
+/// Returns an iterator pointing to value.
+template <class T, class Hook>
+typename IntrusiveLList<T, Hook>::iterator
+         IntrusiveLList<T, Hook>::insert(const_iterator position, T& value) {
+    Hook* hook = static_cast<Hook*>(&value);
+
+    // Verify value is free and position is valid
+    if (hook->is_linked()) {
+        throw std::invalid_argument("Element is already in a list");
+    }
+    if (position.current == nullptr) {
+        throw std::invalid_argument("Out of Range!");
+    }
+
+    link(position.current, hook);
+    ++count;
+
+    return iterator(hook, &root);
+}
+
+/// Iterator erase(const_iterator position): IntrusiveLList
+/// Unlinks the element at position; the element itself is untouched. The
+/// element must be in this list: an element in no list through Hook throws,
+/// while one in another list through the same Hook cannot be told apart in
+/// constant time and would corrupt the sizes of both lists.
+/// Returns the iterator following the unlinked element.
+template <class T, class Hook>
+typename IntrusiveLList<T, Hook>::iterator
+         IntrusiveLList<T, Hook>::erase(const_iterator position) {
+    // Verify position designates a linked element
+    if (position.current == nullptr || position.current == &root) {
+        throw std::invalid_argument("Out of Range!");
+    }
+    if (!position.current->is_linked()) {
+        throw std::invalid_argument("Element is not in a list");
+    }
+
+    Hook* next = static_cast<Hook*>(position.current->next);
+    unlink(position.current);
+    --count;
+
+    return iterator(next, &root);
+}
+
+/// Void remove(T& value): IntrusiveLList
+/// Unlinks value, which must be in this list, in constant time: no search
+/// is needed, as value knows its neighbors. Throws like erase() if value is
+/// in no list through Hook.
+template <class T, class Hook>
+void IntrusiveLList<T, Hook>::remove(T& value) {
+    erase(iterator_to(value));
+}
+
+/// Void swap(IntrusiveLList& other) noexcept: IntrusiveLList
+/// Swaps the elements of the list with other.
+template <class T, class Hook>
+void IntrusiveLList<T, Hook>::swap(IntrusiveLList& other) noexcept {
+    IntrusiveLList temp(std::move(other));
+    other.adopt(*this);
+    adopt(temp);
+}
+
+/// Void clear() noexcept: IntrusiveLList
+/// Unlinks all elements, leaving their hooks free for other lists.
+template <class T, class Hook>
+void IntrusiveLList<T, Hook>::clear() noexcept {
+    Hook* current = static_cast<Hook*>(root.next);
+    while (current != &root) {
+        Hook* next = static_cast<Hook*>(current->next);
+        current->prev = current->next = nullptr;
+        current = next;
+    }
+
+    root.prev = root.next = &root;
+    count = 0;
+}
+
+/* ========== Operations: IntrusiveLList ========== */
+/// Void splice(const_iterator position, IntrusiveLList& other,
+///             const_iterator it): IntrusiveLList
+/// Moves the element at it from other to before position in constant time;
+/// other may be this list. Both iterators are checked before anything is
+/// unlinked.
+template <class T, class Hook>
+void IntrusiveLList<T, Hook>::splice(const_iterator position,
+                                     IntrusiveLList& other,
+                                     const_iterator it) {
+    if (position.current == nullptr) {
+        throw std::invalid_argument("Out of Range!");
+    }
+    if (it == position) {
+        return;
+    }
+
+    Hook* hook = it.current;
+    other.erase(it);
+    link(position.current, hook);
+    ++count;
+}
+
+/// Void splice(const_iterator position, IntrusiveLList& other):
+/// IntrusiveLList
+/// Moves all elements of other before position in constant time, leaving
+/// other empty.
+template <class T, class Hook>
+void IntrusiveLList<T, Hook>::splice(const_iterator position,
+                                     IntrusiveLList& other) {
+    if (this == &other || other.empty()) {
+        return;
+    }
+    if (position.current == nullptr) {
+        throw std::invalid_argument("Out of Range!");
+    }
+
+    Hook* first = static_cast<Hook*>(other.root.next);
+    Hook* last  = static_cast<Hook*>(other.root.prev);
+    Hook* prev  = static_cast<Hook*>(position.current->prev);
+
+    first->prev = prev;
+    prev->next = first;
+    last->next = position.current;
+    position.current->prev = last;
+    count += other.count;
+
+    other.root.prev = other.root.next = &other.root;
+    other.count = 0;
+}
+
+/// Void link(Hook* position, Hook* hook) noexcept: IntrusiveLList
+/// Links hook before position in the ring.
+template <class T, class Hook>
+void IntrusiveLList<T, Hook>::link(Hook* position, Hook* hook) noexcept {
+    hook->prev = position->prev;
+    hook->next = position;
+    position->prev->next = hook;
+    position->prev = hook;
+}
+
+/// Void unlink(Hook* hook) noexcept: IntrusiveLList
+/// Joins the neighbors of hook and frees it.
+template <class T, class Hook>
+void IntrusiveLList<T, Hook>::unlink(Hook* hook) noexcept {
+    hook->prev->next = hook->next;
+    hook->next->prev = hook->prev;
+    hook->prev = hook->next = nullptr;
+}
+
+/// Void adopt(IntrusiveLList& other) noexcept: IntrusiveLList
+/// Takes over the elements of other while this list is empty, moving the
+/// ring from other's root to this one.
+template <class T, class Hook>
+void IntrusiveLList<T, Hook>::adopt(IntrusiveLList& other) noexcept {
+    if (!other.empty()) {
+        root.next = other.root.next;
+        root.prev = other.root.prev;
+        root.next->prev = &root;
+        root.prev->next = &root;
+        count = other.count;
+
+        other.root.prev = other.root.next = &other.root;
+        other.count = 0;
+    }
+}
+
+#endif  // INTRUSIVE_LLIST_HPP
+
+// EOF: IntrusiveLList.hpp
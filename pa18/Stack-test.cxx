@@ -17,10 +17,12 @@
 
 #include <string>
 #include <stdexcept>
+#include <type_traits>
 
 #define CATCH_CONFIG_MAIN
 #include "catch.hpp"
 #include "Stack.hpp"
+#include "StaticStack.hpp"
 
 // Test Default Constructor
 TEST_CASE("Default Constructor", "[Stack]") {
@@ -226,5 +228,103 @@ TEST_CASE("Handling different data types", "[Stack]") {
     }
 }
 
+// Test Move and Emplace
+TEST_CASE("push by move and emplace", "[Stack]") {
+    Stack<std::string> stack;
+
+    SECTION("push moves an rvalue into the stack") {
+        std::string word(40, 'a');
+        stack.push(std::move(word));
+        CHECK(stack.top() == std::string(40, 'a'));
+        CHECK(stack.size() == 1);
+    }
+
+    SECTION("emplace constructs the top element in place") {
+        CHECK(stack.emplace(3, 'b') == "bbb");
+        CHECK(stack.top() == "bbb");
+        stack.pop();
+        CHECK(stack.empty());
+    }
+}
+
+// Test Backing Containers
+TEST_CASE("backing container", "[Stack]") {
+    SECTION("the default container is Vector") {
+        CHECK(std::is_same<Stack<int>::container_type, Vector<int>>::value);
+    }
+
+    SECTION("LList can back the stack") {
+        Stack<std::string, LList<std::string>> stack;
+        CHECK_THROWS_AS(stack.top(), std::out_of_range);
+
+        stack.push("a");
+        stack.emplace(2, 'b');
+        CHECK(stack.size() == 2);
+        CHECK(stack.top() == "bb");
+
+        Stack<std::string, LList<std::string>> copy(stack);
+        stack.pop();
+        CHECK(stack.top() == "a");
+        CHECK(copy.top() == "bb");
+
+        stack.swap(copy);
+        CHECK(stack.size() == 2);
+        CHECK(copy.size() == 1);
+        copy.pop();
+        copy.pop();
+        CHECK(copy.empty());
+    }
+}
+
+// Test StaticStack
+TEST_CASE("StaticStack", "[StaticStack]") {
+    StaticStack<std::string, 2> stack;
+
+    SECTION("elements stay inline up to the inline capacity") {
+        CHECK_THROWS_AS(stack.top(), std::out_of_range);
+        CHECK_NOTHROW(stack.pop());
+
+        stack.push("a");
+        stack.emplace(2, 'b');
+        CHECK(stack.is_inline());
+        CHECK(stack.size() == 2);
+        CHECK(stack.top() == "bb");
+    }
+
+    SECTION("a deeper stack moves to the heap and keeps its elements") {
+        for (int i = 0; i < 5; ++i) {
+            stack.push(std::to_string(i));
+        }
+        stack.push(stack.top());
+        CHECK_FALSE(stack.is_inline());
+        CHECK(stack.size() == 6);
+        CHECK(stack.top() == "4");
+        stack.pop();
+        stack.pop();
+        CHECK(stack.top() == "3");
+    }
+
+    SECTION("copy, move and swap") {
+        StaticStack<std::string, 2> deep;
+        for (int i = 0; i < 3; ++i) {
+            deep.push(std::to_string(i));
+        }
+        stack.push("x");
+
+        StaticStack<std::string, 2> copy(deep);
+        StaticStack<std::string, 2> moved(std::move(stack));
+        CHECK(copy.size() == 3);
+        CHECK(copy.top() == "2");
+        CHECK(moved.top() == "x");
+        CHECK(stack.empty());
+
+        moved.swap(copy);
+        CHECK(moved.size() == 3);
+        CHECK(copy.size() == 1);
+        CHECK(copy.top() == "x");
+        CHECK(deep.top() == "2");
+    }
+}
+
 /* EOF */
 
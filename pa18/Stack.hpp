@@ -25,7 +25,11 @@
 #define STACK_HPP
 
 // Preprocessor Directive(s)
+#include <stdexcept>
+#include <utility>
+
 #include "LList.hpp"
+#include "Vector.hpp"
 
 /// @brief A Stack class template implementing a LIFO data structure.
 ///
@@ -33,57 +37,116 @@
 /// first-out) data structure functionality. It acts as a wrapper around the
 /// underlying container, limiting access to a specific set of functions.
 ///
-/// @tparam T Type of the elements.
+/// The container defaults to Vector, whose elements lie in one growable
+/// array: once its capacity covers the deepest the stack gets, push and pop
+/// do not allocate, and top() reads the end of the array. LList remains
+/// available as Stack<T, LList<T>>, for elements that must keep their address
+/// while the stack grows.
+///
+/// top() still checks for an empty stack and throws std::out_of_range, as it
+/// always has: callers and Stack-test rely on that, and the check is one
+/// compare of the size, which the branch predictor learns is never taken.
+///
+/// @tparam T         Type of the elements.
+/// @tparam Container Container to store the elements in; it must provide
+///                   empty, size, back, push_back, emplace_back and pop_back
+///                   (default Vector<T>).
 
-template <class T>
-class Stack : protected LList<T> {
+template <class T, class Container = Vector<T>>
+class Stack : protected Container {
 public:
     /// Type aliases
-    using value_type      = typename LList<T>::value_type;
-    using reference       = typename LList<T>::reference;
-    using const_reference = typename LList<T>::const_reference;
-    using size_type       = typename LList<T>::size_type;
+    using container_type  = Container;
+    using value_type      = typename Container::value_type;
+    using reference       = typename Container::reference;
+    using const_reference = typename Container::const_reference;
+    using size_type       = typename Container::size_type;
 
 public:
     /// Default constructor.
-    Stack() : LList<T>() {}
+    Stack() : Container() {}
+
+    /// Constructs the stack over a copy of cont, bottom element first.
+    /// @param cont The container to copy, such as a Vector reserved for the
+    /// deepest the stack will get.
+    explicit Stack(const Container& cont) : Container(cont) {}
+
+    /// Constructs the stack over cont, moved in, bottom element first.
+    /// @param cont The container to move, such as a Vector reserved for the
+    /// deepest the stack will get.
+    explicit Stack(Container&& cont) : Container(std::move(cont)) {}
 
     /// Copy constructor.
     /// @param other Another stack to be used as source to initialize
     /// the elements of the stack with.
-    Stack(const Stack& other) : LList<T>(other) {}
+    Stack(const Stack& other) : Container(other) {}
 
     /// Move constructor.
     /// @param other Another stack to be used as source to initialize
     /// the elements of the stack, with.
-    Stack(Stack&& other) : LList<T>(std::move(other)) {}
+    Stack(Stack&& other) noexcept : Container(std::move(other)) {}
 
     /// Checks if the stack is empty.
     /// @return True if the stack is empty, false otherwise.
-    bool empty() const { return LList<T>::empty(); }
+    bool empty() const { return Container::empty(); }
 
     /// Returns the number of elements in the stack.
     /// @return The number of elements in the stack.
-    size_type size() const { return LList<T>::size(); }
+    size_type size() const { return Container::size(); }
 
     /// Accesses the top element.
     /// @return A reference to the top element in the stack.
-    reference top() { return LList<T>::back(); }
+    /// @throws std::out_of_range if the stack is empty; the check is kept
+    ///         for compatibility (see the class comment).
+    reference top() {
+        if (Container::empty()) {
+            throw std::out_of_range("Stack is empty");
+        }
+
+        return Container::back();
+    }
 
     /// Accesses the top element.
     /// @return A const reference to the top element in the stack.
-    const_reference top() const { return LList<T>::back(); }
+    /// @throws std::out_of_range if the stack is empty; the check is kept
+    ///         for compatibility (see the class comment).
+    const_reference top() const {
+        if (Container::empty()) {
+            throw std::out_of_range("Stack is empty");
+        }
+
+        return Container::back();
+    }
 
     /// Pushes an element on top of the stack.
     /// @param value The value to push on the stack.
-    void push(const value_type& value) { LList<T>::push_back(value); }
+    void push(const value_type& value) { Container::push_back(value); }
 
-    /// Removes the top element from the stack.
-    void pop() { LList<T>::pop_back(); }
+    /// Pushes an element on top of the stack, moving it into the stack.
+    /// @param value The value to push on the stack.
+    void push(value_type&& value) { Container::push_back(std::move(value)); }
+
+    /// Pushes a new element on top of the stack, constructed in place.
+    /// @param args Arguments to construct the element from.
+    /// @return A reference to the new top element.
+    template <class... Args>
+    reference emplace(Args&&... args) {
+        return Container::emplace_back(std::forward<Args>(args)...);
+    }
+
+    /// Removes the top element from the stack, if any.
+    void pop() {
+        if (!Container::empty()) {
+            Container::pop_back();
+        }
+    }
 
     /// Swaps the contents with another stack.
     /// @param other Another stack to swap the contents with.
-    void swap(Stack& other) { LList<T>::swap(other); }
+    void swap(Stack& other) {
+        std::swap(static_cast<Container&>(*this),
+                  static_cast<Container&>(other));
+    }
 };
 
 #endif  // STACK_HPP
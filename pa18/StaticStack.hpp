@@ -0,0 +1,339 @@
+/// @file StaticStack.hpp
+/// @author David Tom <8000190528@student.csn.edu>
+/// @date 10/18/26
+///
+/// @brief This file declares StaticStack, a LIFO stack with the interface of
+/// Stack that keeps its first N elements inside the object itself. A stack
+/// that stays within N elements, like the operator and operand stacks of an
+/// expression evaluator, lives wholly on the call stack and never touches
+/// the allocator; a deeper one moves to the heap and keeps growing there.
+///
+/// Example usage:
+/// @code
+///   StaticStack<int, 32> operands;     // 32 ints inline, no allocation
+///   operands.push(2);
+///   operands.push(3);
+///   const int b = operands.top(); operands.pop();
+///   const int a = operands.top(); operands.pop();
+///   operands.push(a + b);
+/// @endcode
+
+#ifndef STATIC_STACK_HPP
+#define STATIC_STACK_HPP
+
+#include <cstddef>      // provides std::size_t
+#include <memory>       // provides std::allocator
+#include <new>          // provides placement new and std::launder
+#include <stdexcept>
+#include <type_traits>
+#include <utility>      // provides std::forward, std::move and std::swap
+
+/// StaticStack is a container adaptor like Stack over storage of its own:
+/// an inline array of N elements, replaced by a heap array of twice the
+/// capacity each time it fills up. The elements are only moved when the
+/// stack outgrows its storage, or when a stack on inline storage is moved.
+/// Once on the heap, the stack stays there until it is cleared by moving
+/// from it.
+///
+/// top() on an empty stack throws std::out_of_range and pop() on an empty
+/// stack does nothing, as with Stack.
+///
+/// @tparam T Type of the elements.
+/// @tparam N Number of elements stored inline.
+template <class T, std::size_t N>
+class StaticStack {
+    static_assert(N > 0, "StaticStack needs room for one element inline");
+
+public:
+    /// Type aliases
+    using value_type      = T;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using size_type       = std::size_t;
+
+    /// Number of elements stored inline.
+    static const size_type INLINE_CAPACITY = N;
+
+    /* Constructors and Destructor */
+    StaticStack() noexcept;
+    StaticStack(const StaticStack& other);
+    StaticStack(StaticStack&& other) noexcept(
+        std::is_nothrow_move_constructible<T>::value);
+    ~StaticStack();
+
+    /* Assignment */
+    StaticStack& operator=(const StaticStack& other);
+    StaticStack& operator=(StaticStack&& other) noexcept(
+        std::is_nothrow_move_constructible<T>::value);
+
+    /* Capacity */
+    bool      empty() const noexcept { return m_size == 0; }
+    size_type size() const noexcept { return m_size; }
+    size_type capacity() const noexcept { return m_capacity; }
+    bool      is_inline() const noexcept { return m_data == inlineData(); }
+
+    /* Element Access */
+    reference       top();
+    const_reference top() const;
+
+    /* Modifiers */
+    void push(const value_type& value) { emplace(value); }
+    void push(value_type&& value) { emplace(std::move(value)); }
+
+    template <class... Args>
+    reference emplace(Args&&... args);
+    void      pop();
+    void      swap(StaticStack& other);
+
+private:
+    template <class... Args>
+    reference emplaceGrow(Args&&... args);
+    void      adopt(StaticStack& other) noexcept(
+        std::is_nothrow_move_constructible<T>::value);
+    void      destroyAll() noexcept;
+
+    T*       inlineData() noexcept {
+        return std::launder(reinterpret_cast<T*>(m_inline));
+    }
+    const T* inlineData() const noexcept {
+        return std::launder(reinterpret_cast<const T*>(m_inline));
+    }
+
+    alignas(T) unsigned char m_inline[N * sizeof(T)];  ///< Inline elements
+    T*        m_data;      ///< The elements: m_inline or a heap array
+    size_type m_size;      ///< Number of elements
+    size_type m_capacity;  ///< Elements m_data has room for
+};
+
+// ----------------------------------------------------------------------------
+
+/* Constructors and Destructor */
+
+/// Constructs an empty stack on its inline storage.
+template <class T, std::size_t N>
+StaticStack<T, N>::StaticStack() noexcept
+    : m_data(inlineData()), m_size(0), m_capacity(N) {}
+
+/// Constructs a stack with copies of the elements of other, in order, on
+/// inline storage if they fit.
+/// @param other Another stack to copy the elements from.
+template <class T, std::size_t N>
+StaticStack<T, N>::StaticStack(const StaticStack& other) : StaticStack() {
+    try {
+        for (size_type i = 0; i < other.m_size; ++i) {
+            emplace(other.m_data[i]);
+        }
+    } catch (...) {
+        destroyAll();
+        throw;
+    }
+}
+
+/// Constructs a stack with the elements of other: its heap array is taken
+/// over, inline elements are moved one by one. other is left empty.
+/// @param other Another stack to move the elements from.
+template <class T, std::size_t N>
+StaticStack<T, N>::StaticStack(StaticStack&& other) noexcept(
+    std::is_nothrow_move_constructible<T>::value)
+    : StaticStack() {
+    adopt(other);
+}
+
+/// Destructs the stack, destroying the elements and freeing a heap array.
+template <class T, std::size_t N>
+StaticStack<T, N>::~StaticStack() {
+    destroyAll();
+}
+
+/* Assignment */
+
+/// Replaces the elements with copies of the elements of other.
+/// @param other Another stack to copy the elements from.
+/// @return      This stack.
+template <class T, std::size_t N>
+StaticStack<T, N>& StaticStack<T, N>::operator=(const StaticStack& other) {
+    if (this != &other) {
+        StaticStack copy(other);
+        destroyAll();
+        adopt(copy);
+    }
+
+    return *this;
+}
+
+/// Replaces the elements with those of other, leaving other empty.
+/// @param other Another stack to move the elements from.
+/// @return      This stack.
+template <class T, std::size_t N>
+StaticStack<T, N>& StaticStack<T, N>::operator=(StaticStack&& other) noexcept(
+    std::is_nothrow_move_constructible<T>::value) {
+    if (this != &other) {
+        destroyAll();
+        adopt(other);
+    }
+
+    return *this;
+}
+
+/* Element Access */
+
+/// Accesses the top element.
+/// @return A reference to the top element in the stack.
+/// @throws std::out_of_range if the stack is empty.
+template <class T, std::size_t N>
+typename StaticStack<T, N>::reference StaticStack<T, N>::top() {
+    if (m_size == 0) {
+        throw std::out_of_range("Stack is empty");
+    }
+
+    return m_data[m_size - 1];
+}
+
+template <class T, std::size_t N>
+typename StaticStack<T, N>::const_reference StaticStack<T, N>::top() const {
+    if (m_size == 0) {
+        throw std::out_of_range("Stack is empty");
+    }
+
+    return m_data[m_size - 1];
+}
+
+/* Modifiers */
+
+/// Pushes a new element on top of the stack, constructed in place. Moves
+/// the stack to a larger heap array first if its storage is full.
+/// @param args Arguments to construct the element from.
+/// @return     A reference to the new top element.
+template <class T, std::size_t N>
+template <class... Args>
+typename StaticStack<T, N>::reference
+StaticStack<T, N>::emplace(Args&&... args) {
+    if (m_size == m_capacity) {
+        return emplaceGrow(std::forward<Args>(args)...);
+    }
+
+    T* element = ::new (static_cast<void*>(m_data + m_size))
+        T(std::forward<Args>(args)...);
+    ++m_size;
+    return *element;
+}
+
+/// Removes the top element from the stack, if any.
+template <class T, std::size_t N>
+void StaticStack<T, N>::pop() {
+    if (m_size > 0) {
+        --m_size;
+        m_data[m_size].~T();
+    }
+}
+
+/// Swaps the contents with another stack.
+/// @param other Another stack to swap the contents with.
+template <class T, std::size_t N>
+void StaticStack<T, N>::swap(StaticStack& other) {
+    if (this == &other) {
+        return;
+    }
+
+    if (!is_inline() && !other.is_inline()) {
+        std::swap(m_data, other.m_data);
+        std::swap(m_size, other.m_size);
+        std::swap(m_capacity, other.m_capacity);
+    } else {
+        StaticStack held(std::move(other));
+        other = std::move(*this);
+        *this = std::move(held);
+    }
+}
+
+/* Private Helpers */
+
+/// Pushes a new element on a full stack: constructs it in a heap array of
+/// twice the capacity, then moves the elements over (or copies them, if
+/// their move may throw and copying may not). The element is constructed
+/// first, so that args may refer to an element of the stack. If anything
+/// throws, the stack is left as it was.
+/// @param args Arguments to construct the element from.
+/// @return     A reference to the new top element.
+template <class T, std::size_t N>
+template <class... Args>
+typename StaticStack<T, N>::reference
+StaticStack<T, N>::emplaceGrow(Args&&... args) {
+    std::allocator<T> alloc;
+    const size_type   capacity = m_capacity * 2;
+    T*                fresh = alloc.allocate(capacity);
+    size_type         moved = 0;
+
+    try {
+        ::new (static_cast<void*>(fresh + m_size))
+            T(std::forward<Args>(args)...);
+        try {
+            for (; moved < m_size; ++moved) {
+                ::new (static_cast<void*>(fresh + moved))
+                    T(std::move_if_noexcept(m_data[moved]));
+            }
+        } catch (...) {
+            fresh[m_size].~T();
+            throw;
+        }
+    } catch (...) {
+        for (size_type i = 0; i < moved; ++i) {
+            fresh[i].~T();
+        }
+        alloc.deallocate(fresh, capacity);
+        throw;
+    }
+
+    const size_type count = m_size;
+    destroyAll();
+    m_data = fresh;
+    m_size = count + 1;
+    m_capacity = capacity;
+
+    return m_data[count];
+}
+
+/// Takes the elements of other into this empty stack: its heap array is
+/// taken over, inline elements are moved one by one. other is left empty
+/// on its inline storage.
+/// @param other Another stack to move the elements from.
+template <class T, std::size_t N>
+void StaticStack<T, N>::adopt(StaticStack& other) noexcept(
+    std::is_nothrow_move_constructible<T>::value) {
+    if (!other.is_inline()) {
+        m_data = other.m_data;
+        m_size = other.m_size;
+        m_capacity = other.m_capacity;
+
+        other.m_data = other.inlineData();
+        other.m_size = 0;
+        other.m_capacity = N;
+        return;
+    }
+
+    for (; m_size < other.m_size; ++m_size) {
+        ::new (static_cast<void*>(m_data + m_size))
+            T(std::move(other.m_data[m_size]));
+    }
+    other.destroyAll();
+}
+
+/// Destroys the elements and frees a heap array, leaving the stack empty
+/// on its inline storage.
+template <class T, std::size_t N>
+void StaticStack<T, N>::destroyAll() noexcept {
+    for (size_type i = 0; i < m_size; ++i) {
+        m_data[i].~T();
+    }
+
+    if (!is_inline()) {
+        std::allocator<T>().deallocate(m_data, m_capacity);
+        m_data = inlineData();
+        m_capacity = N;
+    }
+    m_size = 0;
+}
+
+#endif  // STATIC_STACK_HPP
+
+// EOF: StaticStack.hpp
@@ -22,7 +22,7 @@
 #include <string>           // std::string use
 #include <sstream>          // String streams
 #include <stdexcept>        // Throw exceptions
-#include "Stack.hpp"        // Include the custom stack template file
+#include "StaticStack.hpp"  // Stack template with inline storage
 
 /// -------------------------------------------------------------------------
 /// Function Prototype(s)
@@ -34,6 +34,10 @@ int eval_postfix(const std::string& postfix);
 // Helper Functions
 int precedence(char op);
 
+/// Elements the operator and operand stacks hold inline; deeper expressions
+/// make them move to the heap.
+const std::size_t STACK_INLINE = 64;
+
 /// -------------------------------------------------------------------------
 /// Main entry-point for this application
 ///
@@ -88,7 +92,7 @@ int main() {
 /// @endcode
 
 std::string infix2postfix(const std::string& infix) {
-    Stack<char> stack;              // Stores stack values
+    StaticStack<char, STACK_INLINE> stack;  // Stores stack values
     std::stringstream postfix;      // Stores postfix values
     std::stringstream ss(infix);    // Tracks infix values for processing
     std::string token;              // String to track infix value
@@ -167,7 +171,7 @@ std::string infix2postfix(const std::string& infix) {
 /// @endcode
 
 int eval_postfix(const std::string& postfix) {
-    Stack<int> stack;                   // Stores stack values
+    StaticStack<int, STACK_INLINE> stack;   // Stores stack values
     std::stringstream ss(postfix);      // Tracks postfix string values
     std::string token;                  // String to track postfix values
 